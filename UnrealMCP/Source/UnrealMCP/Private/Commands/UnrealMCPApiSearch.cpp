@@ -0,0 +1,594 @@
+#include "Commands/UnrealMCPApiSearch.h"
+#include "Commands/UnrealMCPCommonUtils.h"
+#include "Commands/UnrealMCPFunctionIndex.h"
+#include "GameFramework/Actor.h"
+#include "Components/ActorComponent.h"
+#include "Misc/ScopeLock.h"
+#include "Algo/BinarySearch.h"
+#include "UObject/Class.h"
+#include "UObject/UnrealType.h"
+
+FCriticalSection FUnrealMCPApiSearch::CatalogLock;
+TSharedPtr<const FUnrealMCPApiSearch::FCatalog> FUnrealMCPApiSearch::CurrentCatalog;
+bool FUnrealMCPApiSearch::bStale = true;
+
+static constexpr int32 ApiSearchDefaultLimit = 20;
+static constexpr int32 ApiSearchMaxLimit = 100;
+
+bool FUnrealMCPApiSearch::IsSearchCommand(const FString& CommandType)
+{
+    return CommandType == TEXT("search_functions") || CommandType == TEXT("search_classes");
+}
+
+bool FUnrealMCPApiSearch::IsReady()
+{
+    FScopeLock Lock(&CatalogLock);
+    return CurrentCatalog.IsValid() && !bStale;
+}
+
+void FUnrealMCPApiSearch::Invalidate()
+{
+    FScopeLock Lock(&CatalogLock);
+    bStale = true;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPApiSearch::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    const TSharedPtr<const FCatalog> Catalog = GetCatalog();
+    if (!Catalog.IsValid())
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("The API index is still being built; retry shortly"));
+    }
+
+    if (CommandType == TEXT("search_functions"))
+    {
+        return SearchFunctions(*Catalog, Params);
+    }
+    return SearchClasses(*Catalog, Params);
+}
+
+TSharedPtr<const FUnrealMCPApiSearch::FCatalog> FUnrealMCPApiSearch::GetCatalog()
+{
+    {
+        FScopeLock Lock(&CatalogLock);
+        if ((CurrentCatalog.IsValid() && !bStale) || !IsInGameThread())
+        {
+            return CurrentCatalog;
+        }
+    }
+
+    // Only the game thread may read the reflection data the snapshot is taken from
+    TSharedPtr<const FCatalog> NewCatalog = BuildCatalog();
+
+    FScopeLock Lock(&CatalogLock);
+    CurrentCatalog = NewCatalog;
+    bStale = false;
+    return CurrentCatalog;
+}
+
+TSharedPtr<const FUnrealMCPApiSearch::FCatalog> FUnrealMCPApiSearch::BuildCatalog()
+{
+    FUnrealMCPFunctionIndex::EnsureBuilt();
+
+    const double StartTime = FPlatformTime::Seconds();
+    TSharedPtr<FCatalog> NewCatalog = MakeShared<FCatalog>();
+
+    auto GetModuleName = [](const UObject* Object)
+    {
+        FString Module = Object->GetOutermost()->GetName();
+        Module.RemoveFromStart(TEXT("/Script/"));
+        return Module;
+    };
+
+    // Parent paths per class record, resolved to record indices once every class is in
+    TArray<FString> ParentPaths;
+    for (const TPair<FName, TArray<TWeakObjectPtr<UClass>>>& Entry : FUnrealMCPFunctionIndex::ClassesByName)
+    {
+        for (const TWeakObjectPtr<UClass>& WeakClass : Entry.Value)
+        {
+            const UClass* Class = WeakClass.Get();
+            if (!Class || Class->HasAnyClassFlags(CLASS_Deprecated | CLASS_NewerVersionExists))
+            {
+                continue;
+            }
+
+            FClassRecord& Record = NewCatalog->Classes.AddDefaulted_GetRef();
+            Record.Name = Class->GetName();
+            Record.Path = Class->GetPathName();
+            Record.ParentName = Class->GetSuperClass() ? Class->GetSuperClass()->GetName() : FString();
+            ParentPaths.Add(Class->GetSuperClass() ? Class->GetSuperClass()->GetPathName().ToLower() : FString());
+            Record.Module = GetModuleName(Class);
+            Record.bAbstract = Class->HasAnyClassFlags(CLASS_Abstract);
+
+            if (Class->IsChildOf(AActor::StaticClass()))
+            {
+                Record.Kind = TEXT("actor");
+            }
+            else if (Class->IsChildOf(UActorComponent::StaticClass()))
+            {
+                Record.Kind = TEXT("component");
+            }
+            else
+            {
+                Record.Kind = TEXT("object");
+            }
+
+            // The same test spawn_actor and add_component_to_blueprint apply
+            Record.bSpawnable = FUnrealMCPFunctionIndex::IsSpawnable(Class);
+
+            NewCatalog->ClassIndicesByName.FindOrAdd(Record.Name.ToLower()).Add(NewCatalog->Classes.Num() - 1);
+            NewCatalog->ClassIndexByPath.Add(Record.Path.ToLower(), NewCatalog->Classes.Num() - 1);
+            NewCatalog->ClassKeys.Add(MakeSearchKey(Record.Name, Record.Module.ToLower()));
+        }
+    }
+
+    for (int32 Index = 0; Index < NewCatalog->Classes.Num(); ++Index)
+    {
+        if (const int32* ParentIndex = NewCatalog->ClassIndexByPath.Find(ParentPaths[Index]))
+        {
+            NewCatalog->Classes[Index].ParentIndex = *ParentIndex;
+        }
+    }
+
+    for (const TPair<FName, TArray<FUnrealMCPFunctionIndex::FFunctionEntry>>& Entry : FUnrealMCPFunctionIndex::FunctionsByName)
+    {
+        for (const FUnrealMCPFunctionIndex::FFunctionEntry& FunctionEntry : Entry.Value)
+        {
+            const UFunction* Function = FunctionEntry.Function.Get();
+            const UClass* Class = FunctionEntry.Class.Get();
+            if (!Function || !Class)
+            {
+                continue;
+            }
+
+            FFunctionRecord& Record = NewCatalog->Functions.AddDefaulted_GetRef();
+            Record.Name = Function->GetName();
+            Record.DisplayName = Function->GetMetaData(TEXT("DisplayName"));
+            Record.ClassName = Class->GetName();
+            Record.ClassPath = Class->GetPathName();
+            Record.Module = GetModuleName(Class);
+            Record.Category = Function->GetMetaData(TEXT("Category"));
+            Record.bStatic = Function->HasAnyFunctionFlags(FUNC_Static);
+            Record.bPure = Function->HasAnyFunctionFlags(FUNC_BlueprintPure);
+
+            // C++-style signature, so callers see parameter names and types without another round trip
+            FString ReturnType = TEXT("void");
+            TArray<FString> Parameters;
+            for (TFieldIterator<FProperty> It(Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+            {
+                if (It->HasAnyPropertyFlags(CPF_ReturnParm))
+                {
+                    ReturnType = It->GetCPPType();
+                }
+                else
+                {
+                    const bool bOut = It->HasAnyPropertyFlags(CPF_OutParm) && !It->HasAnyPropertyFlags(CPF_ConstParm | CPF_ReferenceParm);
+                    Parameters.Add(FString::Printf(TEXT("%s%s %s"), bOut ? TEXT("out ") : TEXT(""), *It->GetCPPType(), *It->GetName()));
+                }
+            }
+            Record.Signature = FString::Printf(TEXT("%s%s %s::%s(%s)"), Record.bStatic ? TEXT("static ") : TEXT(""),
+                *ReturnType, *Record.ClassName, *Record.Name, *FString::Join(Parameters, TEXT(", ")));
+
+            NewCatalog->FunctionKeys.Add(MakeSearchKey(Record.Name,
+                FString::Printf(TEXT("%s %s %s"), *Record.ClassName, *Record.Category, *Record.DisplayName).ToLower()));
+        }
+    }
+
+    BuildTokenIndex(NewCatalog->FunctionKeys, NewCatalog->FunctionTokens);
+    BuildTokenIndex(NewCatalog->ClassKeys, NewCatalog->ClassTokens);
+
+    UE_LOG(LogTemp, Display, TEXT("UnrealMCP: API search catalog of %d functions and %d classes built in %.1f ms"),
+        NewCatalog->Functions.Num(), NewCatalog->Classes.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    return NewCatalog;
+}
+
+// Sort by score, then shorter names first, and return one page of record indices
+static void RankAndPage(TArray<TPair<int32, int32>>& Scored, const TFunctionRef<const FString&(int32)>& GetName,
+                        const TSharedPtr<FJsonObject>& Params, int32& OutOffset, int32& OutLimit)
+{
+    Scored.Sort([&GetName](const TPair<int32, int32>& A, const TPair<int32, int32>& B)
+    {
+        if (A.Value != B.Value)
+        {
+            return A.Value > B.Value;
+        }
+        const FString& NameA = GetName(A.Key);
+        const FString& NameB = GetName(B.Key);
+        return NameA.Len() != NameB.Len() ? NameA.Len() < NameB.Len() : NameA < NameB;
+    });
+
+    OutOffset = 0;
+    OutLimit = ApiSearchDefaultLimit;
+    Params->TryGetNumberField(TEXT("offset"), OutOffset);
+    Params->TryGetNumberField(TEXT("limit"), OutLimit);
+    OutOffset = FMath::Max(OutOffset, 0);
+    OutLimit = FMath::Clamp(OutLimit, 1, ApiSearchMaxLimit);
+}
+
+static void SetPageFields(const TSharedPtr<FJsonObject>& ResultObj, int32 Total, int32 Offset, int32 Limit, int32 Returned)
+{
+    ResultObj->SetNumberField(TEXT("total"), Total);
+    ResultObj->SetNumberField(TEXT("offset"), Offset);
+    ResultObj->SetNumberField(TEXT("limit"), Limit);
+    if (Offset + Returned < Total)
+    {
+        ResultObj->SetNumberField(TEXT("next_offset"), Offset + Returned);
+    }
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPApiSearch::SearchFunctions(const FCatalog& InCatalog, const TSharedPtr<FJsonObject>& Params)
+{
+    FString QueryText;
+    FString ClassName;
+    Params->TryGetStringField(TEXT("query"), QueryText);
+    Params->TryGetStringField(TEXT("class"), ClassName);
+    if (QueryText.IsEmpty() && ClassName.IsEmpty())
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'query' or 'class' parameter"));
+    }
+
+    FString Category;
+    Params->TryGetStringField(TEXT("category"), Category);
+    bool bStaticOnly = false;
+    Params->TryGetBoolField(TEXT("static_only"), bStaticOnly);
+
+    // A class narrows to functions callable on it: its own and its parents'
+    TSet<FString> CallableOn;
+    if (!ClassName.IsEmpty())
+    {
+        FString ClassError;
+        const int32 ClassIndex = FindClassRecord(InCatalog, ClassName, ClassError);
+        if (ClassIndex == INDEX_NONE)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(ClassError);
+        }
+
+        for (int32 Index = ClassIndex; Index != INDEX_NONE; Index = InCatalog.Classes[Index].ParentIndex)
+        {
+            CallableOn.Add(InCatalog.Classes[Index].Path);
+        }
+    }
+
+    const FSearchKey Query = MakeSearchKey(QueryText);
+    TArray<int32> Candidates;
+    GatherCandidates(InCatalog.FunctionTokens, Query, InCatalog.Functions.Num(), Candidates);
+
+    TArray<TPair<int32, int32>> Scored;
+    for (const int32 Index : Candidates)
+    {
+        const FFunctionRecord& Record = InCatalog.Functions[Index];
+        if ((bStaticOnly && !Record.bStatic) ||
+            (CallableOn.Num() > 0 && !CallableOn.Contains(Record.ClassPath)) ||
+            (!Category.IsEmpty() && !Record.Category.Contains(Category, ESearchCase::IgnoreCase)))
+        {
+            continue;
+        }
+
+        const int32 RecordScore = QueryText.IsEmpty() ? 1 : Score(InCatalog.FunctionKeys[Index], Query);
+        if (RecordScore > 0)
+        {
+            Scored.Emplace(Index, RecordScore);
+        }
+    }
+
+    int32 Offset, Limit;
+    RankAndPage(Scored, [&InCatalog](int32 Index) -> const FString& { return InCatalog.Functions[Index].Name; }, Params, Offset, Limit);
+
+    TArray<TSharedPtr<FJsonValue>> Results;
+    for (int32 Rank = Offset; Rank < Scored.Num() && Results.Num() < Limit; ++Rank)
+    {
+        const FFunctionRecord& Record = InCatalog.Functions[Scored[Rank].Key];
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetStringField(TEXT("name"), Record.Name);
+        if (!Record.DisplayName.IsEmpty())
+        {
+            ResultObj->SetStringField(TEXT("display_name"), Record.DisplayName);
+        }
+        ResultObj->SetStringField(TEXT("class"), Record.ClassName);
+        ResultObj->SetStringField(TEXT("module"), Record.Module);
+        ResultObj->SetStringField(TEXT("category"), Record.Category);
+        ResultObj->SetStringField(TEXT("signature"), Record.Signature);
+        ResultObj->SetBoolField(TEXT("static"), Record.bStatic);
+        ResultObj->SetBoolField(TEXT("pure"), Record.bPure);
+        ResultObj->SetNumberField(TEXT("score"), Scored[Rank].Value);
+        Results.Add(MakeShared<FJsonValueObject>(ResultObj));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetArrayField(TEXT("results"), Results);
+    SetPageFields(ResultObj, Scored.Num(), Offset, Limit, Results.Num());
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPApiSearch::SearchClasses(const FCatalog& InCatalog, const TSharedPtr<FJsonObject>& Params)
+{
+    FString QueryText;
+    FString BaseClass;
+    Params->TryGetStringField(TEXT("query"), QueryText);
+    Params->TryGetStringField(TEXT("base_class"), BaseClass);
+    if (QueryText.IsEmpty() && BaseClass.IsEmpty())
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'query' or 'base_class' parameter"));
+    }
+
+    FString Kind;
+    Params->TryGetStringField(TEXT("kind"), Kind);
+    bool bSpawnableOnly = true;
+    Params->TryGetBoolField(TEXT("spawnable_only"), bSpawnableOnly);
+
+    int32 BaseIndex = INDEX_NONE;
+    if (!BaseClass.IsEmpty())
+    {
+        FString ClassError;
+        BaseIndex = FindClassRecord(InCatalog, BaseClass, ClassError);
+        if (BaseIndex == INDEX_NONE)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(ClassError);
+        }
+    }
+
+    auto DerivesFromBase = [&InCatalog, BaseIndex](int32 Index)
+    {
+        for (; Index != INDEX_NONE; Index = InCatalog.Classes[Index].ParentIndex)
+        {
+            if (Index == BaseIndex)
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    const FSearchKey Query = MakeSearchKey(QueryText);
+    TArray<int32> Candidates;
+    GatherCandidates(InCatalog.ClassTokens, Query, InCatalog.Classes.Num(), Candidates);
+
+    TArray<TPair<int32, int32>> Scored;
+    for (const int32 Index : Candidates)
+    {
+        const FClassRecord& Record = InCatalog.Classes[Index];
+        if ((bSpawnableOnly && !Record.bSpawnable) ||
+            (!Kind.IsEmpty() && !Record.Kind.Equals(Kind, ESearchCase::IgnoreCase)) ||
+            (BaseIndex != INDEX_NONE && !DerivesFromBase(Index)))
+        {
+            continue;
+        }
+
+        const int32 RecordScore = QueryText.IsEmpty() ? 1 : Score(InCatalog.ClassKeys[Index], Query);
+        if (RecordScore > 0)
+        {
+            Scored.Emplace(Index, RecordScore);
+        }
+    }
+
+    int32 Offset, Limit;
+    RankAndPage(Scored, [&InCatalog](int32 Index) -> const FString& { return InCatalog.Classes[Index].Name; }, Params, Offset, Limit);
+
+    TArray<TSharedPtr<FJsonValue>> Results;
+    for (int32 Rank = Offset; Rank < Scored.Num() && Results.Num() < Limit; ++Rank)
+    {
+        const FClassRecord& Record = InCatalog.Classes[Scored[Rank].Key];
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetStringField(TEXT("name"), Record.Name);
+        ResultObj->SetStringField(TEXT("path"), Record.Path);
+        ResultObj->SetStringField(TEXT("parent"), Record.ParentName);
+        ResultObj->SetStringField(TEXT("module"), Record.Module);
+        ResultObj->SetStringField(TEXT("kind"), Record.Kind);
+        ResultObj->SetBoolField(TEXT("abstract"), Record.bAbstract);
+        ResultObj->SetBoolField(TEXT("spawnable"), Record.bSpawnable);
+        ResultObj->SetNumberField(TEXT("score"), Scored[Rank].Value);
+        Results.Add(MakeShared<FJsonValueObject>(ResultObj));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetArrayField(TEXT("results"), Results);
+    SetPageFields(ResultObj, Scored.Num(), Offset, Limit, Results.Num());
+    return ResultObj;
+}
+
+FUnrealMCPApiSearch::FSearchKey FUnrealMCPApiSearch::MakeSearchKey(const FString& Name, const FString& Secondary)
+{
+    FSearchKey Key;
+    Key.Lower = Name.ToLower();
+    Tokenize(Name, Key.Tokens);
+    Key.Secondary = Secondary;
+    return Key;
+}
+
+void FUnrealMCPApiSearch::Tokenize(const FString& Text, TArray<FString>& OutTokens)
+{
+    // Split on separators and at case and digit boundaries: "GetActorOfClass" -> get, actor, of, class;
+    // "HTTPRequest" -> http, request
+    FString Current;
+    auto Flush = [&Current, &OutTokens]()
+    {
+        if (!Current.IsEmpty())
+        {
+            OutTokens.AddUnique(Current.ToLower());
+            Current.Reset();
+        }
+    };
+
+    for (int32 Index = 0; Index < Text.Len(); ++Index)
+    {
+        const TCHAR Char = Text[Index];
+        if (!FChar::IsAlnum(Char))
+        {
+            Flush();
+            continue;
+        }
+
+        if (!Current.IsEmpty())
+        {
+            const TCHAR Previous = Text[Index - 1];
+            const bool bNextIsLower = Index + 1 < Text.Len() && FChar::IsLower(Text[Index + 1]);
+            if ((FChar::IsUpper(Char) && (FChar::IsLower(Previous) || (FChar::IsUpper(Previous) && bNextIsLower))) ||
+                (FChar::IsDigit(Char) != FChar::IsDigit(Previous)))
+            {
+                Flush();
+            }
+        }
+        Current.AppendChar(Char);
+    }
+    Flush();
+}
+
+int32 FUnrealMCPApiSearch::Score(const FSearchKey& Key, const FSearchKey& Query)
+{
+    int32 Total = 0;
+
+    // Whole-name matches dominate
+    if (Key.Lower == Query.Lower)
+    {
+        Total += 1000;
+    }
+    else if (Key.Lower.StartsWith(Query.Lower))
+    {
+        Total += 600;
+    }
+    else if (Key.Lower.Contains(Query.Lower))
+    {
+        Total += 350;
+    }
+
+    // Then how many query words appear as words of the name, or at least in its context
+    int32 Missing = 0;
+    for (const FString& QueryToken : Query.Tokens)
+    {
+        int32 Best = 0;
+        for (const FString& Token : Key.Tokens)
+        {
+            Best = FMath::Max(Best, Token == QueryToken ? 100 : Token.StartsWith(QueryToken) ? 60 : 0);
+        }
+        if (Best == 0 && (Key.Lower.Contains(QueryToken) || Key.Secondary.Contains(QueryToken)))
+        {
+            Best = 20;
+        }
+        Missing += Best == 0 ? 1 : 0;
+        Total += Best;
+    }
+
+    // Nothing matched word-wise: fall back to an in-order character match to tolerate typos and abbreviations
+    if (Total == 0)
+    {
+        FString Compact = Query.Lower;
+        Compact.ReplaceInline(TEXT(" "), TEXT(""));
+        Compact.ReplaceInline(TEXT("_"), TEXT(""));
+        return FuzzyScore(Key.Lower, Compact);
+    }
+
+    return FMath::Max(Total - Missing * 40, 1);
+}
+
+int32 FUnrealMCPApiSearch::FuzzyScore(const FString& Candidate, const FString& Pattern)
+{
+    if (Pattern.IsEmpty())
+    {
+        return 0;
+    }
+
+    int32 Total = 100;
+    int32 PatternIndex = 0;
+    int32 LastMatch = INDEX_NONE;
+    for (int32 Index = 0; Index < Candidate.Len() && PatternIndex < Pattern.Len(); ++Index)
+    {
+        if (Candidate[Index] != Pattern[PatternIndex])
+        {
+            continue;
+        }
+
+        // Reward runs of adjacent characters, penalize gaps
+        Total += LastMatch == Index - 1 ? 5 : -FMath::Min(Index - LastMatch - 1, 10);
+        LastMatch = Index;
+        ++PatternIndex;
+    }
+
+    return PatternIndex == Pattern.Len() ? FMath::Clamp(Total, 1, 99) : 0;
+}
+
+void FUnrealMCPApiSearch::BuildTokenIndex(const TArray<FSearchKey>& Keys, FTokenIndex& OutIndex)
+{
+    TMap<FString, TArray<int32>> ByToken;
+    for (int32 Index = 0; Index < Keys.Num(); ++Index)
+    {
+        for (const FString& Token : Keys[Index].Tokens)
+        {
+            // Tokens of a key are unique, so each record is added once per token
+            ByToken.FindOrAdd(Token).Add(Index);
+        }
+    }
+
+    ByToken.KeySort(TLess<FString>());
+    OutIndex.Tokens.Reserve(ByToken.Num());
+    OutIndex.Records.Reserve(ByToken.Num());
+    for (TPair<FString, TArray<int32>>& Entry : ByToken)
+    {
+        OutIndex.Tokens.Add(Entry.Key);
+        OutIndex.Records.Add(MoveTemp(Entry.Value));
+    }
+}
+
+void FUnrealMCPApiSearch::GatherCandidates(const FTokenIndex& TokenIndex, const FSearchKey& Query, int32 RecordCount, TArray<int32>& OutCandidates)
+{
+    // Records sharing a word or word prefix with the query; without any, every record goes to the fuzzy pass.
+    // Tokens starting with a prefix sort together right after it, so each query token is one range.
+    TSet<int32> Found;
+    for (const FString& QueryToken : Query.Tokens)
+    {
+        for (int32 Index = Algo::LowerBound(TokenIndex.Tokens, QueryToken);
+             Index < TokenIndex.Tokens.Num() && TokenIndex.Tokens[Index].StartsWith(QueryToken, ESearchCase::CaseSensitive);
+             ++Index)
+        {
+            Found.Append(TokenIndex.Records[Index]);
+        }
+    }
+
+    if (Found.Num() > 0)
+    {
+        OutCandidates = Found.Array();
+        return;
+    }
+
+    OutCandidates.Reserve(RecordCount);
+    for (int32 Index = 0; Index < RecordCount; ++Index)
+    {
+        OutCandidates.Add(Index);
+    }
+}
+
+int32 FUnrealMCPApiSearch::FindClassRecord(const FCatalog& Catalog, const FString& ClassName, FString& OutErrorMessage)
+{
+    FString Lower = ClassName.ToLower();
+    if (Lower.StartsWith(TEXT("/")))
+    {
+        if (const int32* Index = Catalog.ClassIndexByPath.Find(Lower))
+        {
+            return *Index;
+        }
+    }
+    else
+    {
+        const TArray<int32>* Indices = Catalog.ClassIndicesByName.Find(Lower);
+        if (!Indices && Lower.Len() > 1 && (Lower[0] == TEXT('u') || Lower[0] == TEXT('a')))
+        {
+            Indices = Catalog.ClassIndicesByName.Find(Lower.RightChop(1));
+        }
+        if (Indices && Indices->Num() == 1)
+        {
+            return (*Indices)[0];
+        }
+        if (Indices && Indices->Num() > 1)
+        {
+            TArray<FString> Paths;
+            for (const int32 Index : *Indices)
+            {
+                Paths.Add(Catalog.Classes[Index].Path);
+            }
+            OutErrorMessage = FString::Printf(TEXT("Class name '%s' is ambiguous; use one of: %s"), *ClassName, *FString::Join(Paths, TEXT(", ")));
+            return INDEX_NONE;
+        }
+    }
+
+    OutErrorMessage = FString::Printf(TEXT("Class not found: %s"), *ClassName);
+    return INDEX_NONE;
+}
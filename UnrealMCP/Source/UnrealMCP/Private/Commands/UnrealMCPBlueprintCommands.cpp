@@ -1,5 +1,9 @@
 #include "Commands/UnrealMCPBlueprintCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "Commands/UnrealMCPBlueprintIndex.h"
+#include "Commands/UnrealMCPCompileQueue.h"
+#include "Commands/UnrealMCPFunctionIndex.h"
+#include "Commands/UnrealMCPPerformanceAudit.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Factories/BlueprintFactory.h"
@@ -18,6 +22,8 @@
 #include "UObject/FieldPath.h"
 #include "EditorAssetLibrary.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Misc/PackageName.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/Pawn.h"
 
@@ -47,6 +53,10 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCommand(const FString
     {
         return HandleCompileBlueprint(Params);
     }
+    else if (CommandType == TEXT("compile_blueprints"))
+    {
+        return HandleCompileBlueprints(Params);
+    }
     else if (CommandType == TEXT("spawn_blueprint_actor"))
     {
         return HandleSpawnBlueprintActor(Params);
@@ -63,6 +73,10 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCommand(const FString
     {
         return HandleSetPawnProperties(Params);
     }
+    else if (CommandType == TEXT("audit_blueprint_performance"))
+    {
+        return HandleAuditBlueprintPerformance(Params);
+    }
     
     return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown blueprint command: %s"), *CommandType));
 }
@@ -76,12 +90,15 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCreateBlueprint(const
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'name' parameter"));
     }
 
-    // Check if blueprint already exists
+    // Blueprints are looked up by name project-wide, so the name must be free everywhere, not just in this folder
     FString PackagePath = TEXT("/Game/Blueprints/");
     FString AssetName = BlueprintName;
-    if (UEditorAssetLibrary::DoesAssetExist(PackagePath + AssetName))
+    TArray<FSoftObjectPath> ExistingPaths;
+    FUnrealMCPBlueprintIndex::GetPathsForName(AssetName, ExistingPaths);
+    if (ExistingPaths.Num() > 0 || UEditorAssetLibrary::DoesAssetExist(PackagePath + AssetName))
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint already exists: %s"), *BlueprintName));
+        const FString ExistingPath = ExistingPaths.Num() > 0 ? ExistingPaths[0].ToString() : PackagePath + AssetName;
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint already exists: %s (%s)"), *BlueprintName, *ExistingPath));
     }
 
     // Create the blueprint factory
@@ -184,43 +201,23 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleAddComponentToBluepri
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString FindError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, FindError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FindError);
     }
 
-    // Create the component - dynamically find the component class by name
-    UClass* ComponentClass = nullptr;
-
-    // Try to find the class with exact name first
-    ComponentClass = FindObject<UClass>(ANY_PACKAGE, *ComponentType);
-    
-    // If not found, try with "Component" suffix
-    if (!ComponentClass && !ComponentType.EndsWith(TEXT("Component")))
-    {
-        FString ComponentTypeWithSuffix = ComponentType + TEXT("Component");
-        ComponentClass = FindObject<UClass>(ANY_PACKAGE, *ComponentTypeWithSuffix);
-    }
-    
-    // If still not found, try with "U" prefix
-    if (!ComponentClass && !ComponentType.StartsWith(TEXT("U")))
+    // Any concrete component class, by short, prefixed or /Script path name
+    FString ClassError;
+    UClass* ComponentClass = FUnrealMCPFunctionIndex::FindClass(ComponentType, ClassError, UActorComponent::StaticClass());
+    if (!ComponentClass)
     {
-        FString ComponentTypeWithPrefix = TEXT("U") + ComponentType;
-        ComponentClass = FindObject<UClass>(ANY_PACKAGE, *ComponentTypeWithPrefix);
-        
-        // Try with both prefix and suffix
-        if (!ComponentClass && !ComponentType.EndsWith(TEXT("Component")))
-        {
-            FString ComponentTypeWithBoth = TEXT("U") + ComponentType + TEXT("Component");
-            ComponentClass = FindObject<UClass>(ANY_PACKAGE, *ComponentTypeWithBoth);
-        }
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown component type: %s (%s)"), *ComponentType, *ClassError));
     }
-    
-    // Verify that the class is a valid component type
-    if (!ComponentClass || !ComponentClass->IsChildOf(UActorComponent::StaticClass()))
+    if (!FUnrealMCPFunctionIndex::IsSpawnable(ComponentClass))
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown component type: %s"), *ComponentType));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Component type is abstract or deprecated: %s"), *ComponentClass->GetName()));
     }
 
     // Add the component to the blueprint
@@ -248,8 +245,9 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleAddComponentToBluepri
         // Add to root if no parent specified
         Blueprint->SimpleConstructionScript->AddNode(NewNode);
 
-        // Compile the blueprint
-        FKismetEditorUtilities::CompileBlueprint(Blueprint);
+        // Refresh the skeleton now; the full compile waits for the compile queue
+        FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+        FUnrealMCPCompileQueue::MarkDirty(Blueprint);
 
         TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
         ResultObj->SetStringField(TEXT("component_name"), ComponentName);
@@ -309,11 +307,12 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetComponentProperty(
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString FindError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, FindError);
     if (!Blueprint)
     {
-        UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - Blueprint not found: %s"), *BlueprintName);
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - %s"), *FindError);
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FindError);
     }
     else
     {
@@ -765,10 +764,11 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetPhysicsProperties(
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString FindError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, FindError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FindError);
     }
 
     // Find the component
@@ -835,18 +835,241 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCompileBlueprint(cons
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString FindError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, FindError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FindError);
     }
 
-    // Compile the blueprint
-    FKismetEditorUtilities::CompileBlueprint(Blueprint);
+    bool bForce = false;
+    Params->TryGetBoolField(TEXT("force"), bForce);
+
+    // Compile the blueprint, together with any other edits still waiting in the compile queue.
+    // A blueprint unchanged since its last successful compile keeps that result unless forced.
+    TArray<UBlueprint*> Skipped;
+    const int32 CompiledCount = FUnrealMCPCompileQueue::Flush(Blueprint, bForce, &Skipped);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetStringField(TEXT("name"), BlueprintName);
     ResultObj->SetBoolField(TEXT("compiled"), true);
+    ResultObj->SetBoolField(TEXT("cached"), Skipped.Contains(Blueprint));
+    ResultObj->SetBoolField(TEXT("has_errors"), Blueprint->Status == BS_Error);
+    ResultObj->SetNumberField(TEXT("compiled_count"), CompiledCount);
+    return ResultObj;
+}
+
+// Whether a class or one of its parents is named ClassName, with or without its prefix
+static bool IsClassNamed(const UClass* Class, const FString& ClassName)
+{
+    for (; Class; Class = Class->GetSuperClass())
+    {
+        if (Class->GetName() == ClassName || FString(Class->GetPrefixCPP()) + Class->GetName() == ClassName)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// The same test from asset registry tags alone, so blueprints that do not match are never loaded.
+// Blueprint parents are followed through their own tags up to the first native class.
+static bool AssetDerivesFromClassNamed(const FAssetData& AssetData, const FString& ClassName, const IAssetRegistry& AssetRegistry)
+{
+    FAssetData Current = AssetData;
+    for (int32 Depth = 0; Depth < 32 && Current.IsValid(); ++Depth)
+    {
+        FString ParentPath;
+        if (!Current.GetTagValue(FBlueprintTags::ParentClassPath, ParentPath))
+        {
+            break;
+        }
+        ParentPath = FPackageName::ExportTextPathToObjectPath(ParentPath);
+
+        if (ParentPath.StartsWith(TEXT("/Script/")))
+        {
+            return IsClassNamed(FindObject<UClass>(nullptr, *ParentPath), ClassName);
+        }
+
+        // A blueprint parent: its generated class is Name_C, its asset is Name
+        FString ParentName = FPackageName::ObjectPathToObjectName(ParentPath);
+        ParentName.RemoveFromEnd(TEXT("_C"));
+        if (ParentName == ClassName || ParentName + TEXT("_C") == ClassName)
+        {
+            return true;
+        }
+        ParentPath.RemoveFromEnd(TEXT("_C"));
+        Current = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(ParentPath));
+    }
+
+    // Tags missing (e.g. never resaved): fall back to the native parent tag
+    FString NativeParentPath;
+    if (AssetData.GetTagValue(FBlueprintTags::NativeParentClassPath, NativeParentPath))
+    {
+        return IsClassNamed(FindObject<UClass>(nullptr, *FPackageName::ExportTextPathToObjectPath(NativeParentPath)), ClassName);
+    }
+    return false;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCompileBlueprints(const TSharedPtr<FJsonObject>& Params)
+{
+    TArray<UBlueprint*> Blueprints;
+    TArray<TSharedPtr<FJsonValue>> BlueprintResults;
+    int32 FailedCount = 0;
+
+    // Named blueprints resolve through the blueprint index; a name that does not resolve is reported, not fatal
+    const TArray<TSharedPtr<FJsonValue>>* Names = nullptr;
+    const bool bHasNames = Params->TryGetArrayField(TEXT("blueprints"), Names);
+    if (bHasNames)
+    {
+        for (const TSharedPtr<FJsonValue>& NameValue : *Names)
+        {
+            const FString Name = NameValue->AsString();
+            FString FindError;
+            if (UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(Name, FindError))
+            {
+                Blueprints.AddUnique(Blueprint);
+                continue;
+            }
+
+            TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+            Entry->SetStringField(TEXT("name"), Name);
+            Entry->SetStringField(TEXT("status"), TEXT("not_found"));
+            Entry->SetArrayField(TEXT("errors"), { MakeShared<FJsonValueString>(FindError) });
+            BlueprintResults.Add(MakeShared<FJsonValueObject>(Entry));
+            ++FailedCount;
+        }
+    }
+
+    // Keep only blueprints deriving from a class, matched by name with or without its prefix
+    FString ParentClassName;
+    Params->TryGetStringField(TEXT("parent_class"), ParentClassName);
+
+    // Everything under a content folder, subfolders included
+    FString Path;
+    if (Params->TryGetStringField(TEXT("path"), Path))
+    {
+        Path.RemoveFromEnd(TEXT("/"));
+
+        FARFilter Filter;
+        Filter.PackagePaths.Add(FName(*Path));
+        Filter.bRecursivePaths = true;
+        Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+        Filter.bRecursiveClasses = true;
+
+        // The parent filter runs on registry tags first, so only matching blueprints are loaded
+        const IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+        TArray<FAssetData> Assets;
+        AssetRegistry.GetAssets(Filter, Assets);
+        for (const FAssetData& AssetData : Assets)
+        {
+            if (!ParentClassName.IsEmpty() && !AssetDerivesFromClassNamed(AssetData, ParentClassName, AssetRegistry))
+            {
+                continue;
+            }
+            if (UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset()))
+            {
+                Blueprints.AddUnique(Blueprint);
+            }
+        }
+    }
+
+    if (!bHasNames && Path.IsEmpty())
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprints' or 'path' parameter"));
+    }
+
+    // Named blueprints are loaded already; check them against their actual classes
+    if (!ParentClassName.IsEmpty())
+    {
+        Blueprints.RemoveAll([&ParentClassName](const UBlueprint* Blueprint)
+        {
+            return !IsClassNamed(Blueprint->ParentClass, ParentClassName);
+        });
+    }
+
+    FString Mode = TEXT("batch");
+    Params->TryGetStringField(TEXT("mode"), Mode);
+    bool bIncludeDependents = true;
+    Params->TryGetBoolField(TEXT("include_dependents"), bIncludeDependents);
+    bool bForce = false;
+    Params->TryGetBoolField(TEXT("force"), bForce);
+
+    // Batch mode hands everything to the compilation manager at once, so reinstancing and
+    // dependency propagation happen a single time. Sequential mode compiles one blueprint at a
+    // time, which is slower but gives each one its own timing.
+    const bool bSequential = Mode == TEXT("sequential");
+    TMap<const UBlueprint*, double> SecondsPerBlueprint;
+    TArray<UBlueprint*> Skipped;
+    int32 CompiledCount = 0;
+    const double StartTime = FPlatformTime::Seconds();
+    if (bSequential)
+    {
+        for (UBlueprint* Blueprint : Blueprints)
+        {
+            const double BlueprintStartTime = FPlatformTime::Seconds();
+            CompiledCount += FUnrealMCPCompileQueue::CompileNow({ Blueprint }, bIncludeDependents, bForce, &Skipped);
+            SecondsPerBlueprint.Add(Blueprint, FPlatformTime::Seconds() - BlueprintStartTime);
+        }
+    }
+    else
+    {
+        CompiledCount = FUnrealMCPCompileQueue::CompileNow(Blueprints, bIncludeDependents, bForce, &Skipped);
+    }
+    const double TotalSeconds = FPlatformTime::Seconds() - StartTime;
+
+    int32 WarningCount = 0;
+    for (UBlueprint* Blueprint : Blueprints)
+    {
+        TArray<FString> Errors;
+        TArray<FString> Warnings;
+        FUnrealMCPCompileQueue::GetCompilerMessages(Blueprint, Errors, Warnings);
+
+        const TCHAR* Status = TEXT("dirty");
+        switch (Blueprint->Status)
+        {
+        case BS_UpToDate:             Status = TEXT("up_to_date"); break;
+        case BS_UpToDateWithWarnings: Status = TEXT("warnings"); break;
+        case BS_Error:                Status = TEXT("error"); break;
+        default: break;
+        }
+        FailedCount += Blueprint->Status == BS_Error ? 1 : 0;
+        WarningCount += Blueprint->Status == BS_UpToDateWithWarnings ? 1 : 0;
+
+        TArray<TSharedPtr<FJsonValue>> ErrorValues;
+        for (const FString& Error : Errors)
+        {
+            ErrorValues.Add(MakeShared<FJsonValueString>(Error));
+        }
+        TArray<TSharedPtr<FJsonValue>> WarningValues;
+        for (const FString& Warning : Warnings)
+        {
+            WarningValues.Add(MakeShared<FJsonValueString>(Warning));
+        }
+
+        TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+        Entry->SetStringField(TEXT("name"), Blueprint->GetName());
+        Entry->SetStringField(TEXT("path"), Blueprint->GetPathName());
+        Entry->SetStringField(TEXT("status"), Status);
+        Entry->SetBoolField(TEXT("cached"), Skipped.Contains(Blueprint));
+        Entry->SetArrayField(TEXT("errors"), ErrorValues);
+        Entry->SetArrayField(TEXT("warnings"), WarningValues);
+        if (const double* Seconds = SecondsPerBlueprint.Find(Blueprint))
+        {
+            Entry->SetNumberField(TEXT("time_ms"), *Seconds * 1000.0);
+        }
+        BlueprintResults.Add(MakeShared<FJsonValueObject>(Entry));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("mode"), bSequential ? TEXT("sequential") : TEXT("batch"));
+    ResultObj->SetNumberField(TEXT("requested_count"), Blueprints.Num());
+    ResultObj->SetNumberField(TEXT("compiled_count"), CompiledCount);
+    ResultObj->SetNumberField(TEXT("cached_count"), Skipped.Num());
+    ResultObj->SetNumberField(TEXT("failed_count"), FailedCount);
+    ResultObj->SetNumberField(TEXT("warning_count"), WarningCount);
+    ResultObj->SetNumberField(TEXT("total_ms"), TotalSeconds * 1000.0);
+    ResultObj->SetArrayField(TEXT("blueprints"), BlueprintResults);
     return ResultObj;
 }
 
@@ -866,10 +1089,11 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSpawnBlueprintActor(c
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString FindError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, FindError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FindError);
     }
 
     // Get transform parameters
@@ -896,6 +1120,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSpawnBlueprintActor(c
     SpawnTransform.SetLocation(Location);
     SpawnTransform.SetRotation(FQuat(Rotation));
 
+    FUnrealMCPCompileQueue::EnsureCompiled(Blueprint);
     AActor* NewActor = World->SpawnActor<AActor>(Blueprint->GeneratedClass, SpawnTransform);
     if (NewActor)
     {
@@ -922,13 +1147,15 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetBlueprintProperty(
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString FindError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, FindError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FindError);
     }
 
     // Get the default object
+    FUnrealMCPCompileQueue::EnsureCompiled(Blueprint);
     UObject* DefaultObject = Blueprint->GeneratedClass->GetDefaultObject();
     if (!DefaultObject)
     {
@@ -976,10 +1203,11 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetStaticMeshProperti
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString FindError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, FindError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FindError);
     }
 
     // Find the component
@@ -1043,13 +1271,15 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetPawnProperties(con
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString FindError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, FindError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FindError);
     }
 
     // Get the default object
+    FUnrealMCPCompileQueue::EnsureCompiled(Blueprint);
     UObject* DefaultObject = Blueprint->GeneratedClass->GetDefaultObject();
     if (!DefaultObject)
     {
@@ -1157,4 +1387,95 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetPawnProperties(con
     ResponseObj->SetBoolField(TEXT("success"), bAnyPropertiesSet);
     ResponseObj->SetObjectField(TEXT("results"), ResultsObj);
     return ResponseObj;
-} 
\ No newline at end of file
+} 
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleAuditBlueprintPerformance(const TSharedPtr<FJsonObject>& Params)
+{
+    // One blueprint by name, or every blueprint under a content folder
+    TArray<UBlueprint*> Blueprints;
+    FString BlueprintName;
+    FString Path;
+    if (Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+    {
+        FString FindError;
+        UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, FindError);
+        if (!Blueprint)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FindError);
+        }
+        Blueprints.Add(Blueprint);
+    }
+    else if (Params->TryGetStringField(TEXT("path"), Path))
+    {
+        Path.RemoveFromEnd(TEXT("/"));
+
+        FARFilter Filter;
+        Filter.PackagePaths.Add(FName(*Path));
+        Filter.bRecursivePaths = true;
+        Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+        Filter.bRecursiveClasses = true;
+
+        TArray<FAssetData> Assets;
+        FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get().GetAssets(Filter, Assets);
+        for (const FAssetData& AssetData : Assets)
+        {
+            if (UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset()))
+            {
+                Blueprints.Add(Blueprint);
+            }
+        }
+    }
+    else
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' or 'path' parameter"));
+    }
+
+    // Optional overrides of what counts as too large
+    FUnrealMCPPerformanceAudit::FThresholds Thresholds;
+    const TSharedPtr<FJsonObject>* ThresholdsJson = nullptr;
+    if (Params->TryGetObjectField(TEXT("thresholds"), ThresholdsJson))
+    {
+        (*ThresholdsJson)->TryGetNumberField(TEXT("tick_nodes"), Thresholds.TickNodes);
+        (*ThresholdsJson)->TryGetNumberField(TEXT("construction_script_nodes"), Thresholds.ConstructionScriptNodes);
+        (*ThresholdsJson)->TryGetNumberField(TEXT("component_count"), Thresholds.ComponentCount);
+        (*ThresholdsJson)->TryGetNumberField(TEXT("component_depth"), Thresholds.ComponentDepth);
+    }
+
+    int32 MaxFindings = 500;
+    Params->TryGetNumberField(TEXT("max_findings"), MaxFindings);
+
+    TArray<TSharedPtr<FJsonValue>> Findings;
+    int32 AuditedCount = 0;
+    for (UBlueprint* Blueprint : Blueprints)
+    {
+        if (Findings.Num() >= MaxFindings)
+        {
+            break;
+        }
+        FUnrealMCPPerformanceAudit::Audit(Blueprint, Thresholds, Findings);
+        ++AuditedCount;
+    }
+
+    const bool bTruncated = Findings.Num() > MaxFindings || AuditedCount < Blueprints.Num();
+    Findings.SetNum(FMath::Min(Findings.Num(), FMath::Max(MaxFindings, 0)));
+
+    // Per-rule totals, so a caller can tell at a glance what dominates
+    TMap<FString, int32> RuleCounts;
+    for (const TSharedPtr<FJsonValue>& Finding : Findings)
+    {
+        ++RuleCounts.FindOrAdd(Finding->AsObject()->GetStringField(TEXT("rule")));
+    }
+    TSharedPtr<FJsonObject> CountsByRule = MakeShared<FJsonObject>();
+    for (const TPair<FString, int32>& RuleCount : RuleCounts)
+    {
+        CountsByRule->SetNumberField(RuleCount.Key, RuleCount.Value);
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetNumberField(TEXT("blueprints_audited"), AuditedCount);
+    ResultObj->SetNumberField(TEXT("blueprints_total"), Blueprints.Num());
+    ResultObj->SetArrayField(TEXT("findings"), Findings);
+    ResultObj->SetObjectField(TEXT("counts_by_rule"), CountsByRule);
+    ResultObj->SetBoolField(TEXT("truncated"), bTruncated);
+    return ResultObj;
+}
@@ -0,0 +1,130 @@
+#include "Commands/UnrealMCPBlueprintHash.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/UnrealType.h"
+
+// Properties that change without changing what the compiler produces: layout, comments,
+// compiler output and editor UI state
+static const TSet<FName> IgnoredHashProperties = {
+    TEXT("NodePosX"), TEXT("NodePosY"), TEXT("NodeWidth"), TEXT("NodeHeight"),
+    TEXT("NodeComment"), TEXT("bCommentBubblePinned"), TEXT("bCommentBubbleVisible"), TEXT("bCommentBubbleMakeVisible"),
+    TEXT("ErrorType"), TEXT("ErrorMsg"), TEXT("bHasCompilerMessage"),
+    TEXT("Status"), TEXT("LastEditedDocuments"), TEXT("CrcLastCompiledCDO"), TEXT("CrcLastCompiledSignature"),
+    TEXT("bIsNewlyCreated"), TEXT("ThumbnailInfo"), TEXT("Bookmarks"), TEXT("BookmarkNodes"),
+};
+
+uint64 FUnrealMCPBlueprintHash::Compute(const UBlueprint* Blueprint)
+{
+    if (!Blueprint)
+    {
+        return 0;
+    }
+
+    // Subobjects are combined with a sum so the result does not depend on the order the
+    // object hash happens to return them in
+    uint64 Hash = HashObject(Blueprint);
+    ForEachObjectWithOuter(Blueprint, [&Hash](UObject* Object)
+    {
+        Hash += HashObject(Object);
+    }, true, RF_Transient);
+    return Hash;
+}
+
+uint64 FUnrealMCPBlueprintHash::ComputeGraph(const UEdGraph* Graph)
+{
+    if (!Graph)
+    {
+        return 0;
+    }
+
+    uint64 Hash = HashObject(Graph);
+    for (const UEdGraphNode* Node : Graph->Nodes)
+    {
+        Hash += HashObject(Node);
+    }
+    return Hash;
+}
+
+uint64 FUnrealMCPBlueprintHash::ComputeNode(const UEdGraphNode* Node)
+{
+    return HashObject(Node);
+}
+
+uint64 FUnrealMCPBlueprintHash::HashObject(const UObject* Object)
+{
+    if (!Object || Object->HasAnyFlags(RF_Transient))
+    {
+        return 0;
+    }
+
+    FXxHash64Builder Builder;
+    HashString(Object->GetClass()->GetPathName(), Builder);
+    HashString(Object->GetName(), Builder);
+    HashProperties(Object, Builder);
+
+    // Pins are not reflected properties, so links and defaults are added by hand
+    if (const UEdGraphNode* Node = Cast<UEdGraphNode>(Object))
+    {
+        for (const UEdGraphPin* Pin : Node->Pins)
+        {
+            if (!Pin)
+            {
+                continue;
+            }
+
+            HashString(Pin->PinName.ToString(), Builder);
+            Builder.Update(&Pin->Direction, sizeof(Pin->Direction));
+            HashString(Pin->PinType.PinCategory.ToString(), Builder);
+            HashString(Pin->PinType.PinSubCategory.ToString(), Builder);
+            HashString(Pin->PinType.PinSubCategoryObject.IsValid() ? Pin->PinType.PinSubCategoryObject->GetPathName() : FString(), Builder);
+            const uint8 TypeFlags = (uint8)Pin->PinType.ContainerType | (Pin->PinType.bIsReference << 4) | (Pin->PinType.bIsConst << 5);
+            Builder.Update(&TypeFlags, sizeof(TypeFlags));
+            HashString(Pin->DefaultValue, Builder);
+            HashString(Pin->DefaultObject ? Pin->DefaultObject->GetPathName() : FString(), Builder);
+            HashString(Pin->DefaultTextValue.ToString(), Builder);
+
+            for (const UEdGraphPin* Linked : Pin->LinkedTo)
+            {
+                if (Linked && Linked->GetOwningNodeUnchecked())
+                {
+                    HashString(Linked->GetOwningNodeUnchecked()->NodeGuid.ToString(), Builder);
+                    HashString(Linked->PinName.ToString(), Builder);
+                }
+            }
+        }
+    }
+
+    return Builder.Finalize().Hash;
+}
+
+void FUnrealMCPBlueprintHash::HashProperties(const UObject* Object, FXxHash64Builder& Builder)
+{
+    FString Exported;
+    for (TFieldIterator<FProperty> It(Object->GetClass()); It; ++It)
+    {
+        const FProperty* Property = *It;
+        if (Property->HasAnyPropertyFlags(CPF_Transient | CPF_DuplicateTransient) || IgnoredHashProperties.Contains(Property->GetFName()))
+        {
+            continue;
+        }
+
+        for (int32 Index = 0; Index < Property->ArrayDim; ++Index)
+        {
+            Exported.Reset();
+            Property->ExportTextItem_Direct(Exported, Property->ContainerPtrToValuePtr<void>(Object, Index), nullptr, nullptr, PPF_None);
+            HashString(Property->GetName(), Builder);
+            HashString(Exported, Builder);
+        }
+    }
+}
+
+void FUnrealMCPBlueprintHash::HashString(const FString& Value, FXxHash64Builder& Builder)
+{
+    // Length first so adjacent strings cannot run into each other
+    const int32 Length = Value.Len();
+    Builder.Update(&Length, sizeof(Length));
+    Builder.Update(*Value, Length * sizeof(TCHAR));
+}
@@ -0,0 +1,233 @@
+#include "Commands/UnrealMCPBlueprintIndex.h"
+#include "Engine/Blueprint.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Misc/PackageName.h"
+
+bool FUnrealMCPBlueprintIndex::bBuilt = false;
+TSet<FTopLevelAssetPath> FUnrealMCPBlueprintIndex::BlueprintClassPaths;
+TMap<FName, TArray<FUnrealMCPBlueprintIndex::FEntry>> FUnrealMCPBlueprintIndex::EntriesByName;
+
+UBlueprint* FUnrealMCPBlueprintIndex::Find(const FString& Name, UClass* BlueprintClass, FString& OutErrorMessage)
+{
+    if (Name.IsEmpty())
+    {
+        OutErrorMessage = TEXT("Blueprint name is empty");
+        return nullptr;
+    }
+
+    EnsureBuilt();
+
+    // A path picks one asset; its last segment is still the name the index is keyed by
+    FSoftObjectPath RequestedPath;
+    FString AssetName = Name;
+    if (Name.StartsWith(TEXT("/")))
+    {
+        FString ObjectPath = Name;
+        if (!ObjectPath.Contains(TEXT(".")))
+        {
+            ObjectPath += TEXT(".") + FPackageName::GetShortName(Name);
+        }
+        RequestedPath = FSoftObjectPath(ObjectPath);
+        AssetName = RequestedPath.GetAssetName();
+    }
+
+    // FNAME_Find avoids growing the name table for names that were never an asset
+    const FName Key(*AssetName, FNAME_Find);
+    TArray<FEntry>* Entries = Key.IsNone() ? nullptr : EntriesByName.Find(Key);
+
+    const FEntry* Match = nullptr;
+    TArray<FString> Candidates;
+    if (Entries)
+    {
+        for (const FEntry& Entry : *Entries)
+        {
+            if (RequestedPath.IsValid() && Entry.AssetData.GetSoftObjectPath() != RequestedPath)
+            {
+                continue;
+            }
+            if (!MatchesClass(Entry, BlueprintClass))
+            {
+                continue;
+            }
+            Match = Match ? Match : &Entry;
+            Candidates.Add(Entry.AssetData.GetObjectPathString());
+        }
+    }
+
+    if (!Match)
+    {
+        OutErrorMessage = FString::Printf(TEXT("Blueprint not found: %s"), *Name);
+        IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+        if (AssetRegistry.IsLoadingAssets())
+        {
+            OutErrorMessage += TEXT(" (the asset registry is still scanning the project)");
+        }
+        return nullptr;
+    }
+
+    if (Candidates.Num() > 1)
+    {
+        Candidates.Sort();
+        OutErrorMessage = FString::Printf(TEXT("Blueprint name '%s' is ambiguous, pass one of these paths instead: %s"),
+            *Name, *FString::Join(Candidates, TEXT(", ")));
+        return nullptr;
+    }
+
+    if (UBlueprint* Blueprint = Match->Blueprint.Get())
+    {
+        return Blueprint;
+    }
+
+    UBlueprint* Blueprint = Load(Match->AssetData);
+    if (!Blueprint)
+    {
+        OutErrorMessage = FString::Printf(TEXT("Failed to load Blueprint: %s"), *Match->AssetData.GetObjectPathString());
+    }
+    return Blueprint;
+}
+
+void FUnrealMCPBlueprintIndex::GetPathsForName(const FString& AssetName, TArray<FSoftObjectPath>& OutPaths)
+{
+    EnsureBuilt();
+
+    OutPaths.Reset();
+    const FName Key(*AssetName, FNAME_Find);
+    if (const TArray<FEntry>* Entries = Key.IsNone() ? nullptr : EntriesByName.Find(Key))
+    {
+        for (const FEntry& Entry : *Entries)
+        {
+            OutPaths.Add(Entry.AssetData.GetSoftObjectPath());
+        }
+    }
+}
+
+void FUnrealMCPBlueprintIndex::Reset()
+{
+    bBuilt = false;
+    BlueprintClassPaths.Reset();
+    EntriesByName.Reset();
+}
+
+void FUnrealMCPBlueprintIndex::EnsureBuilt()
+{
+    if (bBuilt)
+    {
+        return;
+    }
+    bBuilt = true;
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+    // bBuilt is set before the initial query, so registry events forwarded in between are applied;
+    // AddAsset ignores assets that are already indexed
+    // Widget, animation and other blueprint subclasses are indexed too; callers narrow by class
+    const FTopLevelAssetPath BlueprintClassPath = UBlueprint::StaticClass()->GetClassPathName();
+    AssetRegistry.GetDerivedClassNames({ BlueprintClassPath }, {}, BlueprintClassPaths);
+    BlueprintClassPaths.Add(BlueprintClassPath);
+
+    TArray<FAssetData> Assets;
+    AssetRegistry.GetAssetsByClass(BlueprintClassPath, Assets, true);
+    for (const FAssetData& AssetData : Assets)
+    {
+        AddAsset(AssetData);
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("UnrealMCP: indexed %d blueprints under %d names"), Assets.Num(), EntriesByName.Num());
+}
+
+bool FUnrealMCPBlueprintIndex::IsBlueprintAsset(const FAssetData& AssetData)
+{
+    return BlueprintClassPaths.Contains(AssetData.AssetClassPath);
+}
+
+bool FUnrealMCPBlueprintIndex::MatchesClass(const FEntry& Entry, UClass* BlueprintClass)
+{
+    if (!BlueprintClass)
+    {
+        return true;
+    }
+    if (const UBlueprint* Blueprint = Entry.Blueprint.Get())
+    {
+        return Blueprint->IsA(BlueprintClass);
+    }
+    const UClass* AssetClass = Entry.AssetData.GetClass();
+    return AssetClass && AssetClass->IsChildOf(BlueprintClass);
+}
+
+UBlueprint* FUnrealMCPBlueprintIndex::Load(const FAssetData& AssetData)
+{
+    // Copy the identity first: loading can run registry callbacks that reshape the index
+    const FName AssetName = AssetData.AssetName;
+    const FSoftObjectPath ObjectPath = AssetData.GetSoftObjectPath();
+
+    UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset());
+    if (!Blueprint)
+    {
+        return nullptr;
+    }
+
+    if (TArray<FEntry>* Entries = EntriesByName.Find(AssetName))
+    {
+        for (FEntry& Entry : *Entries)
+        {
+            if (Entry.AssetData.GetSoftObjectPath() == ObjectPath)
+            {
+                Entry.Blueprint = Blueprint;
+            }
+        }
+    }
+    return Blueprint;
+}
+
+void FUnrealMCPBlueprintIndex::AddAsset(const FAssetData& AssetData)
+{
+    if (!bBuilt || !IsBlueprintAsset(AssetData))
+    {
+        return;
+    }
+
+    TArray<FEntry>& Entries = EntriesByName.FindOrAdd(AssetData.AssetName);
+    const FSoftObjectPath ObjectPath = AssetData.GetSoftObjectPath();
+    for (FEntry& Entry : Entries)
+    {
+        if (Entry.AssetData.GetSoftObjectPath() == ObjectPath)
+        {
+            Entry.AssetData = AssetData;
+            return;
+        }
+    }
+
+    FEntry& Entry = Entries.AddDefaulted_GetRef();
+    Entry.AssetData = AssetData;
+}
+
+void FUnrealMCPBlueprintIndex::RemoveAsset(FName AssetName, const FSoftObjectPath& ObjectPath)
+{
+    if (!bBuilt)
+    {
+        return;
+    }
+
+    TArray<FEntry>* Entries = EntriesByName.Find(AssetName);
+    if (!Entries)
+    {
+        return;
+    }
+
+    Entries->RemoveAll([&ObjectPath](const FEntry& Entry)
+    {
+        return Entry.AssetData.GetSoftObjectPath() == ObjectPath;
+    });
+    if (Entries->IsEmpty())
+    {
+        EntriesByName.Remove(AssetName);
+    }
+}
+
+void FUnrealMCPBlueprintIndex::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    const FSoftObjectPath OldPath(OldObjectPath);
+    RemoveAsset(FName(*OldPath.GetAssetName()), OldPath);
+    AddAsset(AssetData);
+}
@@ -1,5 +1,10 @@
 #include "Commands/UnrealMCPBlueprintNodeCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "Commands/UnrealMCPCompileQueue.h"
+#include "Commands/UnrealMCPGraphExport.h"
+#include "Commands/UnrealMCPGraphBuilder.h"
+#include "Commands/UnrealMCPNodeSearch.h"
+#include "Commands/UnrealMCPFunctionIndex.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "EdGraph/EdGraph.h"
@@ -16,6 +21,8 @@
 #include "Camera/CameraActor.h"
 #include "Kismet/GameplayStatics.h"
 #include "EdGraphSchema_K2.h"
+#include "ScopedTransaction.h"
+#include "AssetRegistry/AssetRegistryModule.h"
 
 // Declare the log category
 DEFINE_LOG_CATEGORY_STATIC(LogUnrealMCP, Log, All);
@@ -58,6 +65,18 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleCommand(const FSt
     {
         return HandleFindBlueprintNodes(Params);
     }
+    else if (CommandType == TEXT("get_blueprint_graph"))
+    {
+        return HandleGetBlueprintGraph(Params);
+    }
+    else if (CommandType == TEXT("build_blueprint_graph"))
+    {
+        return HandleBuildBlueprintGraph(Params);
+    }
+    else if (CommandType == TEXT("search_blueprint_nodes"))
+    {
+        return HandleSearchBlueprintNodes(Params);
+    }
     
     return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown blueprint node command: %s"), *CommandType));
 }
@@ -96,10 +115,11 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleConnectBlueprintN
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString FindError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, FindError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FindError);
     }
 
     // Get the event graph
@@ -134,6 +154,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleConnectBlueprintN
     {
         // Mark the blueprint as modified
         FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+        FUnrealMCPCompileQueue::MarkDirty(Blueprint);
 
         TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
         ResultObj->SetStringField(TEXT("source_node_id"), SourceNodeId);
@@ -167,10 +188,11 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintGetSe
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString FindError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, FindError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FindError);
     }
 
     // Get the event graph
@@ -208,6 +230,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintGetSe
     
     // Mark the blueprint as modified
     FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    FUnrealMCPCompileQueue::MarkDirty(Blueprint);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetStringField(TEXT("node_id"), GetComponentNode->NodeGuid.ToString());
@@ -237,10 +260,11 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintEvent
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString FindError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, FindError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FindError);
     }
 
     // Get the event graph
@@ -259,6 +283,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintEvent
 
     // Mark the blueprint as modified
     FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    FUnrealMCPCompileQueue::MarkDirty(Blueprint);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetStringField(TEXT("node_id"), EventNode->NodeGuid.ToString());
@@ -292,10 +317,11 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintFunct
     Params->TryGetStringField(TEXT("target"), Target);
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString FindError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, FindError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FindError);
     }
 
     // Get the event graph
@@ -305,161 +331,25 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintFunct
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get event graph"));
     }
 
-    // Find the function
-    UFunction* Function = nullptr;
-    UK2Node_CallFunction* FunctionNode = nullptr;
-    
-    // Add extensive logging for debugging
-    UE_LOG(LogTemp, Display, TEXT("Looking for function '%s' in target '%s'"), 
-           *FunctionName, Target.IsEmpty() ? TEXT("Blueprint") : *Target);
-    
-    // Check if we have a target class specified
-    if (!Target.IsEmpty())
+    // Resolve the function through the callable-function index; without a target the
+    // blueprint's own class is searched first, which needs its pending edits compiled
+    UClass* OwnClass = nullptr;
+    if (Target.IsEmpty())
     {
-        // Try to find the target class
-        UClass* TargetClass = nullptr;
-        
-        // First try without a prefix
-        TargetClass = FindObject<UClass>(ANY_PACKAGE, *Target);
-        UE_LOG(LogTemp, Display, TEXT("Tried to find class '%s': %s"), 
-               *Target, TargetClass ? TEXT("Found") : TEXT("Not found"));
-        
-        // If not found, try with U prefix (common convention for UE classes)
-        if (!TargetClass && !Target.StartsWith(TEXT("U")))
-        {
-            FString TargetWithPrefix = FString(TEXT("U")) + Target;
-            TargetClass = FindObject<UClass>(ANY_PACKAGE, *TargetWithPrefix);
-            UE_LOG(LogTemp, Display, TEXT("Tried to find class '%s': %s"), 
-                   *TargetWithPrefix, TargetClass ? TEXT("Found") : TEXT("Not found"));
-        }
-        
-        // If still not found, try with common component names
-        if (!TargetClass)
-        {
-            // Try some common component class names
-            TArray<FString> PossibleClassNames;
-            PossibleClassNames.Add(FString(TEXT("U")) + Target + TEXT("Component"));
-            PossibleClassNames.Add(Target + TEXT("Component"));
-            
-            for (const FString& ClassName : PossibleClassNames)
-            {
-                TargetClass = FindObject<UClass>(ANY_PACKAGE, *ClassName);
-                if (TargetClass)
-                {
-                    UE_LOG(LogTemp, Display, TEXT("Found class using alternative name '%s'"), *ClassName);
-                    break;
-                }
-            }
-        }
-        
-        // Special case handling for common classes like UGameplayStatics
-        if (!TargetClass && Target == TEXT("UGameplayStatics"))
-        {
-            // For UGameplayStatics, use a direct reference to known class
-            TargetClass = FindObject<UClass>(ANY_PACKAGE, TEXT("UGameplayStatics"));
-            if (!TargetClass)
-            {
-                // Try loading it from its known package
-                TargetClass = LoadObject<UClass>(nullptr, TEXT("/Script/Engine.GameplayStatics"));
-                UE_LOG(LogTemp, Display, TEXT("Explicitly loading GameplayStatics: %s"), 
-                       TargetClass ? TEXT("Success") : TEXT("Failed"));
-            }
-        }
-        
-        // If we found a target class, look for the function there
-        if (TargetClass)
-        {
-            UE_LOG(LogTemp, Display, TEXT("Looking for function '%s' in class '%s'"), 
-                   *FunctionName, *TargetClass->GetName());
-                   
-            // First try exact name
-            Function = TargetClass->FindFunctionByName(*FunctionName);
-            
-            // If not found, try class hierarchy
-            UClass* CurrentClass = TargetClass;
-            while (!Function && CurrentClass)
-            {
-                UE_LOG(LogTemp, Display, TEXT("Searching in class: %s"), *CurrentClass->GetName());
-                
-                // Try exact match
-                Function = CurrentClass->FindFunctionByName(*FunctionName);
-                
-                // Try case-insensitive match
-                if (!Function)
-                {
-                    for (TFieldIterator<UFunction> FuncIt(CurrentClass); FuncIt; ++FuncIt)
-                    {
-                        UFunction* AvailableFunc = *FuncIt;
-                        UE_LOG(LogTemp, Display, TEXT("  - Available function: %s"), *AvailableFunc->GetName());
-                        
-                        if (AvailableFunc->GetName().Equals(FunctionName, ESearchCase::IgnoreCase))
-                        {
-                            UE_LOG(LogTemp, Display, TEXT("  - Found case-insensitive match: %s"), *AvailableFunc->GetName());
-                            Function = AvailableFunc;
-                            break;
-                        }
-                    }
-                }
-                
-                // Move to parent class
-                CurrentClass = CurrentClass->GetSuperClass();
-            }
-            
-            // Special handling for known functions
-            if (!Function)
-            {
-                if (TargetClass->GetName() == TEXT("GameplayStatics") && 
-                    (FunctionName == TEXT("GetActorOfClass") || FunctionName.Equals(TEXT("GetActorOfClass"), ESearchCase::IgnoreCase)))
-                {
-                    UE_LOG(LogTemp, Display, TEXT("Using special case handling for GameplayStatics::GetActorOfClass"));
-                    
-                    // Create the function node directly
-                    FunctionNode = NewObject<UK2Node_CallFunction>(EventGraph);
-                    if (FunctionNode)
-                    {
-                        // Direct setup for known function
-                        FunctionNode->FunctionReference.SetExternalMember(
-                            FName(TEXT("GetActorOfClass")), 
-                            TargetClass
-                        );
-                        
-                        FunctionNode->NodePosX = NodePosition.X;
-                        FunctionNode->NodePosY = NodePosition.Y;
-                        EventGraph->AddNode(FunctionNode);
-                        FunctionNode->CreateNewGuid();
-                        FunctionNode->PostPlacedNewNode();
-                        FunctionNode->AllocateDefaultPins();
-                        
-                        UE_LOG(LogTemp, Display, TEXT("Created GetActorOfClass node directly"));
-                        
-                        // List all pins
-                        for (UEdGraphPin* Pin : FunctionNode->Pins)
-                        {
-                            UE_LOG(LogTemp, Display, TEXT("  - Pin: %s, Direction: %d, Category: %s"), 
-                                   *Pin->PinName.ToString(), (int32)Pin->Direction, *Pin->PinType.PinCategory.ToString());
-                        }
-                    }
-                }
-            }
-        }
+        FUnrealMCPCompileQueue::EnsureCompiled(Blueprint);
+        OwnClass = Blueprint->GeneratedClass;
     }
-    
-    // If we still haven't found the function, try in the blueprint's class
-    if (!Function && !FunctionNode)
+    FString ResolveError;
+    UFunction* Function = FUnrealMCPFunctionIndex::FindFunction(FunctionName, Target, OwnClass, ResolveError);
+    if (!Function)
     {
-        UE_LOG(LogTemp, Display, TEXT("Trying to find function in blueprint class"));
-        Function = Blueprint->GeneratedClass->FindFunctionByName(*FunctionName);
+        return FUnrealMCPCommonUtils::CreateErrorResponse(ResolveError);
     }
-    
-    // Create the function call node if we found the function
-    if (Function && !FunctionNode)
-    {
-        FunctionNode = FUnrealMCPCommonUtils::CreateFunctionCallNode(EventGraph, Function, NodePosition);
-    }
-    
+
+    UK2Node_CallFunction* FunctionNode = FUnrealMCPCommonUtils::CreateFunctionCallNode(EventGraph, Function, NodePosition);
     if (!FunctionNode)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Function not found: %s in target %s"), *FunctionName, Target.IsEmpty() ? TEXT("Blueprint") : *Target));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to create function node: %s"), *FunctionName));
     }
 
     // Set parameters if provided
@@ -497,32 +387,14 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintFunct
                         // Handle class reference parameters (e.g., ActorClass in GetActorOfClass)
                         if (ParamPin->PinType.PinCategory == UEdGraphSchema_K2::PC_Class)
                         {
-                            // For class references, we require the exact class name with proper prefix
-                            // - Actor classes must start with 'A' (e.g., ACameraActor)
-                            // - Non-actor classes must start with 'U' (e.g., UObject)
+                            // Short, prefixed or path names, limited to the pin's meta class (e.g. Actor for GetActorOfClass)
                             const FString& ClassName = StringVal;
-                            
-                            // TODO: This likely won't work in UE5.5+, so don't rely on it.
-                            UClass* Class = FindObject<UClass>(ANY_PACKAGE, *ClassName);
-
+                            FString ClassError;
+                            UClass* Class = FUnrealMCPFunctionIndex::FindClass(ClassName, ClassError, Cast<UClass>(ParamPin->PinType.PinSubCategoryObject.Get()));
                             if (!Class)
                             {
-                                Class = LoadObject<UClass>(nullptr, *ClassName);
-                                UE_LOG(LogUnrealMCP, Display, TEXT("FindObject<UClass> failed. Assuming soft path  path: %s"), *ClassName);
-                            }
-                            
-                            // If not found, try with Engine module path
-                            if (!Class)
-                            {
-                                FString EngineClassName = FString::Printf(TEXT("/Script/Engine.%s"), *ClassName);
-                                Class = LoadObject<UClass>(nullptr, *EngineClassName);
-                                UE_LOG(LogUnrealMCP, Display, TEXT("Trying Engine module path: %s"), *EngineClassName);
-                            }
-                            
-                            if (!Class)
-                            {
-                                UE_LOG(LogUnrealMCP, Error, TEXT("Failed to find class '%s'. Make sure to use the exact class name with proper prefix (A for actors, U for non-actors)"), *ClassName);
-                                return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to find class '%s'"), *ClassName));
+                                UE_LOG(LogUnrealMCP, Error, TEXT("Failed to find class '%s': %s"), *ClassName, *ClassError);
+                                return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to find class '%s': %s"), *ClassName, *ClassError));
                             }
 
                             const UEdGraphSchema_K2* K2Schema = Cast<const UEdGraphSchema_K2>(EventGraph->GetSchema());
@@ -664,6 +536,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintFunct
 
     // Mark the blueprint as modified
     FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    FUnrealMCPCompileQueue::MarkDirty(Blueprint);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetStringField(TEXT("node_id"), FunctionNode->NodeGuid.ToString());
@@ -699,10 +572,11 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintVaria
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString FindError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, FindError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FindError);
     }
 
     // Create variable based on type
@@ -760,6 +634,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintVaria
 
     // Mark the blueprint as modified
     FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    FUnrealMCPCompileQueue::MarkDirty(Blueprint);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetStringField(TEXT("variable_name"), VariableName);
@@ -790,10 +665,11 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintInput
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString FindError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, FindError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FindError);
     }
 
     // Get the event graph
@@ -812,6 +688,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintInput
 
     // Mark the blueprint as modified
     FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    FUnrealMCPCompileQueue::MarkDirty(Blueprint);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetStringField(TEXT("node_id"), InputActionNode->NodeGuid.ToString());
@@ -835,10 +712,11 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintSelfR
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString FindError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, FindError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FindError);
     }
 
     // Get the event graph
@@ -857,6 +735,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintSelfR
 
     // Mark the blueprint as modified
     FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    FUnrealMCPCompileQueue::MarkDirty(Blueprint);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetStringField(TEXT("node_id"), SelfNode->NodeGuid.ToString());
@@ -879,10 +758,11 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleFindBlueprintNode
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString FindError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, FindError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FindError);
     }
 
     // Get the event graph
@@ -921,4 +801,191 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleFindBlueprintNode
     ResultObj->SetArrayField(TEXT("node_guids"), NodeGuidArray);
     
     return ResultObj;
-} 
\ No newline at end of file
+} 
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleGetBlueprintGraph(const TSharedPtr<FJsonObject>& Params)
+{
+    // Get required parameters
+    FString BlueprintName;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+    }
+
+    // Optional graph filter and the revision a previous call returned
+    FString GraphName;
+    Params->TryGetStringField(TEXT("graph_name"), GraphName);
+
+    FString SinceRevision;
+    Params->TryGetStringField(TEXT("since_revision"), SinceRevision);
+
+    // Find the blueprint
+    FString FindError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, FindError);
+    if (!Blueprint)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FindError);
+    }
+
+    if (!GraphName.IsEmpty())
+    {
+        TArray<UEdGraph*> Graphs;
+        Blueprint->GetAllGraphs(Graphs);
+        if (!Graphs.ContainsByPredicate([&GraphName](const UEdGraph* Graph) { return Graph && Graph->GetName() == GraphName; }))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Graph not found: %s"), *GraphName));
+        }
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = FUnrealMCPGraphExport::Export(Blueprint, GraphName, SinceRevision);
+    ResultObj->SetStringField(TEXT("blueprint"), Blueprint->GetPathName());
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleBuildBlueprintGraph(const TSharedPtr<FJsonObject>& Params)
+{
+    // Get required parameters
+    FString BlueprintName;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* Nodes = nullptr;
+    const TArray<TSharedPtr<FJsonValue>>* Links = nullptr;
+    if (!Params->TryGetArrayField(TEXT("nodes"), Nodes) && !Params->TryGetArrayField(TEXT("links"), Links))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'nodes' or 'links' parameter"));
+    }
+
+    // Optional target graph (event graph by default) and whether to compile once at the end
+    FString GraphName;
+    Params->TryGetStringField(TEXT("graph_name"), GraphName);
+
+    bool bCompile = false;
+    Params->TryGetBoolField(TEXT("compile"), bCompile);
+
+    // Find the blueprint
+    FString FindError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, FindError);
+    if (!Blueprint)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FindError);
+    }
+
+    UEdGraph* Graph = nullptr;
+    if (GraphName.IsEmpty())
+    {
+        Graph = FUnrealMCPCommonUtils::FindOrCreateEventGraph(Blueprint);
+    }
+    else
+    {
+        TArray<UEdGraph*> Graphs;
+        Blueprint->GetAllGraphs(Graphs);
+        UEdGraph** Found = Graphs.FindByPredicate([&GraphName](const UEdGraph* Candidate) { return Candidate && Candidate->GetName() == GraphName; });
+        Graph = Found ? *Found : nullptr;
+    }
+    if (!Graph)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(GraphName.IsEmpty() ? FString(TEXT("Failed to get event graph")) : FString::Printf(TEXT("Graph not found: %s"), *GraphName));
+    }
+
+    // One transaction and one modify notification for the whole spec
+    int32 CreatedCount = 0;
+    int32 LinkedCount = 0;
+    TSharedPtr<FJsonObject> ResultObj;
+    {
+        const FScopedTransaction Transaction(FText::FromString(FString::Printf(TEXT("Build graph in %s"), *Blueprint->GetName())));
+        Blueprint->Modify();
+        Graph->Modify();
+
+        ResultObj = FUnrealMCPGraphBuilder::Build(Blueprint, Graph, Params, CreatedCount, LinkedCount);
+
+        if (CreatedCount > 0 || LinkedCount > 0)
+        {
+            FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+        }
+    }
+
+    bool bCompiled = false;
+    if (CreatedCount > 0 || LinkedCount > 0)
+    {
+        if (bCompile)
+        {
+            bCompiled = FUnrealMCPCompileQueue::CompileNow({ Blueprint }) > 0;
+
+            TArray<FString> Errors;
+            TArray<FString> Warnings;
+            FUnrealMCPCompileQueue::GetCompilerMessages(Blueprint, Errors, Warnings);
+
+            TArray<TSharedPtr<FJsonValue>> ErrorsJson;
+            for (const FString& Error : Errors)
+            {
+                ErrorsJson.Add(MakeShared<FJsonValueString>(Error));
+            }
+            TArray<TSharedPtr<FJsonValue>> WarningsJson;
+            for (const FString& Warning : Warnings)
+            {
+                WarningsJson.Add(MakeShared<FJsonValueString>(Warning));
+            }
+            ResultObj->SetArrayField(TEXT("compile_errors"), ErrorsJson);
+            ResultObj->SetArrayField(TEXT("compile_warnings"), WarningsJson);
+        }
+        else
+        {
+            FUnrealMCPCompileQueue::MarkDirty(Blueprint);
+        }
+    }
+
+    ResultObj->SetStringField(TEXT("graph"), Graph->GetName());
+    ResultObj->SetBoolField(TEXT("compiled"), bCompiled);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleSearchBlueprintNodes(const TSharedPtr<FJsonObject>& Params)
+{
+    // Filters, all optional; a node must match every one given
+    FUnrealMCPNodeSearch::FQuery Query;
+    Params->TryGetStringField(TEXT("node_class"), Query.NodeClass);
+    Params->TryGetStringField(TEXT("function_name"), Query.FunctionName);
+    Params->TryGetStringField(TEXT("variable_name"), Query.VariableName);
+    Params->TryGetStringField(TEXT("event_name"), Query.EventName);
+    Params->TryGetStringField(TEXT("comment"), Query.Comment);
+    Params->TryGetStringField(TEXT("graph_name"), Query.GraphName);
+
+    int32 MaxResults = 100;
+    Params->TryGetNumberField(TEXT("max_results"), MaxResults);
+
+    // Blueprints without current records are loaded only on request
+    bool bLoadAssets = false;
+    Params->TryGetBoolField(TEXT("load_assets"), bLoadAssets);
+
+    // One blueprint by name, or every blueprint under a content path (the whole project by default)
+    TArray<FAssetData> Assets;
+    FString BlueprintName;
+    if (Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+    {
+        FString FindError;
+        UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, FindError);
+        if (!Blueprint)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FindError);
+        }
+        Assets.Add(FAssetData(Blueprint));
+    }
+    else
+    {
+        FString Path = TEXT("/Game");
+        Params->TryGetStringField(TEXT("path"), Path);
+        Path.RemoveFromEnd(TEXT("/"));
+
+        FARFilter Filter;
+        Filter.PackagePaths.Add(FName(*Path));
+        Filter.bRecursivePaths = true;
+        Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+        Filter.bRecursiveClasses = true;
+        FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get().GetAssets(Filter, Assets);
+    }
+
+    return FUnrealMCPNodeSearch::Search(Assets, Query, FMath::Max(MaxResults, 0), bLoadAssets);
+}
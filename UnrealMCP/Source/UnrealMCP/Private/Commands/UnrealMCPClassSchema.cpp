@@ -0,0 +1,95 @@
+#include "Commands/UnrealMCPClassSchema.h"
+#include "UObject/UnrealType.h"
+#include "JsonObjectConverter.h"
+
+TMap<FObjectKey, TSharedPtr<const FUnrealMCPClassSchema>> FUnrealMCPClassSchema::Cache;
+
+TSharedPtr<const FUnrealMCPClassSchema> FUnrealMCPClassSchema::Get(UClass* Class)
+{
+    if (!Class)
+    {
+        return nullptr;
+    }
+
+    if (const TSharedPtr<const FUnrealMCPClassSchema>* Found = Cache.Find(FObjectKey(Class)))
+    {
+        return *Found;
+    }
+
+    TSharedPtr<FUnrealMCPClassSchema> Schema = MakeShared<FUnrealMCPClassSchema>();
+    Schema->Build(Class);
+    Cache.Add(FObjectKey(Class), Schema);
+    return Schema;
+}
+
+void FUnrealMCPClassSchema::ClearCache()
+{
+    Cache.Reset();
+}
+
+void FUnrealMCPClassSchema::Build(UClass* Class)
+{
+    for (TFieldIterator<FProperty> It(Class, EFieldIteratorFlags::IncludeSuper); It; ++It)
+    {
+        FProperty* Property = *It;
+
+        // Only what the details panel or blueprints can see; instanced subobjects
+        // such as components are reported separately by the caller
+        if (!Property->HasAnyPropertyFlags(CPF_Edit | CPF_BlueprintVisible) ||
+            Property->HasAnyPropertyFlags(CPF_Deprecated | CPF_InstancedReference | CPF_ContainsInstancedReference))
+        {
+            continue;
+        }
+
+        FEntry& Entry = Entries.AddDefaulted_GetRef();
+        Entry.Property = Property;
+        Entry.Name = Property->GetAuthoredName();
+        Entry.Category = Property->GetMetaData(TEXT("Category"));
+    }
+}
+
+int32 FUnrealMCPClassSchema::SerializeObject(const UObject* Object, const FString& CategoryFilter, const FString& NamePattern, const TSharedPtr<FJsonObject>& OutObject) const
+{
+    if (!Object || !OutObject.IsValid())
+    {
+        return 0;
+    }
+
+    int32 Written = 0;
+    for (const FEntry& Entry : Entries)
+    {
+        if (!CategoryFilter.IsEmpty() &&
+            !Entry.Category.Equals(CategoryFilter, ESearchCase::IgnoreCase) &&
+            !Entry.Category.StartsWith(CategoryFilter + TEXT("|"), ESearchCase::IgnoreCase))
+        {
+            continue;
+        }
+
+        if (!NamePattern.IsEmpty() && !Entry.Name.MatchesWildcard(NamePattern))
+        {
+            continue;
+        }
+
+        TSharedPtr<FJsonValue> Value;
+        if (Entry.Property->ArrayDim == 1)
+        {
+            Value = FJsonObjectConverter::UPropertyToJsonValue(Entry.Property, Entry.Property->ContainerPtrToValuePtr<void>(Object), 0, 0);
+        }
+        else
+        {
+            TArray<TSharedPtr<FJsonValue>> Elements;
+            for (int32 Index = 0; Index < Entry.Property->ArrayDim; ++Index)
+            {
+                Elements.Add(FJsonObjectConverter::UPropertyToJsonValue(Entry.Property, Entry.Property->ContainerPtrToValuePtr<void>(Object, Index), 0, 0));
+            }
+            Value = MakeShared<FJsonValueArray>(Elements);
+        }
+
+        if (Value.IsValid())
+        {
+            OutObject->SetField(Entry.Name, Value);
+            ++Written;
+        }
+    }
+    return Written;
+}
@@ -25,6 +25,14 @@
 #include "BlueprintActionDatabase.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
+#include "Misc/Base64.h"
+#include "EngineUtils.h"
+#include "JsonObjectConverter.h"
+#include "Commands/UnrealMCPPropertyPath.h"
+#include "Commands/UnrealMCPBlueprintIndex.h"
+#include "Commands/UnrealMCPCompileQueue.h"
+#include "UnrealMCPJsonWriter.h"
+#include "UnrealMCPJsonDocument.h"
 
 // JSON Utilities
 TSharedPtr<FJsonObject> FUnrealMCPCommonUtils::CreateErrorResponse(const FString& Message)
@@ -86,6 +94,31 @@ void FUnrealMCPCommonUtils::GetFloatArrayFromJson(const TSharedPtr<FJsonObject>&
     }
 }
 
+void FUnrealMCPCommonUtils::GetFloatArrayFromJson(const FUnrealMCPJsonView& JsonObject, const FString& FieldName, TArray<float>& OutArray)
+{
+    OutArray.Reset();
+
+    FUnrealMCPJsonView JsonArray;
+    if (!JsonObject.TryGetArrayField(*FieldName, JsonArray))
+    {
+        return;
+    }
+
+    // Packed float arrays from binary requests are already in the right layout
+    TConstArrayView<float> PackedFloats;
+    if (JsonArray.TryGetFloatArray(PackedFloats))
+    {
+        OutArray.Append(PackedFloats.GetData(), PackedFloats.Num());
+        return;
+    }
+
+    OutArray.Reserve(JsonArray.Num());
+    JsonArray.ForEachElement([&OutArray](const FUnrealMCPJsonView& Value)
+    {
+        OutArray.Add((float)Value.AsNumber());
+    });
+}
+
 FVector2D FUnrealMCPCommonUtils::GetVector2DFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName)
 {
     FVector2D Result(0.0f, 0.0f);
@@ -145,16 +178,257 @@ FRotator FUnrealMCPCommonUtils::GetRotatorFromJson(const TSharedPtr<FJsonObject>
     return Result;
 }
 
+FVector FUnrealMCPCommonUtils::GetVectorFromJson(const FUnrealMCPJsonView& JsonObject, const FString& FieldName)
+{
+    FVector Result(0.0f, 0.0f, 0.0f);
+
+    FUnrealMCPJsonView JsonArray;
+    if (JsonObject.TryGetArrayField(*FieldName, JsonArray) && JsonArray.Num() >= 3)
+    {
+        int32 Component = 0;
+        JsonArray.ForEachElement([&Result, &Component](const FUnrealMCPJsonView& Value)
+        {
+            if (Component < 3)
+            {
+                Result[Component++] = Value.AsNumber();
+            }
+        });
+    }
+
+    return Result;
+}
+
+FRotator FUnrealMCPCommonUtils::GetRotatorFromJson(const FUnrealMCPJsonView& JsonObject, const FString& FieldName)
+{
+    const FVector Components = GetVectorFromJson(JsonObject, FieldName);
+    return FRotator(Components.X, Components.Y, Components.Z);
+}
+
+bool FUnrealMCPCommonUtils::GetPackedVectorArrayFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName, TArray<FVector>& OutVectors, FString& OutErrorMessage)
+{
+    OutVectors.Reset();
+
+    TSharedPtr<FJsonValue> FieldValue = JsonObject->TryGetField(FieldName);
+    if (!FieldValue.IsValid() || FieldValue->Type == EJson::Null)
+    {
+        return true;
+    }
+
+    // Binary payload: base64 encoded little-endian float32 triples
+    if (FieldValue->Type == EJson::String)
+    {
+        return DecodePackedVectorBase64(FieldValue->AsString(), FieldName, OutVectors, OutErrorMessage);
+    }
+
+    if (FieldValue->Type != EJson::Array)
+    {
+        OutErrorMessage = FString::Printf(TEXT("Field '%s' must be a number array or a base64 string"), *FieldName);
+        return false;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>& Values = FieldValue->AsArray();
+    if (Values.Num() == 0)
+    {
+        return true;
+    }
+
+    // Array of triples: [[x, y, z], ...]
+    if (Values[0]->Type == EJson::Array)
+    {
+        OutVectors.SetNumUninitialized(Values.Num());
+        for (int32 Index = 0; Index < Values.Num(); ++Index)
+        {
+            const TArray<TSharedPtr<FJsonValue>>* Triple = nullptr;
+            if (!Values[Index]->TryGetArray(Triple) || Triple->Num() < 3)
+            {
+                OutErrorMessage = FString::Printf(TEXT("Field '%s' entry %d is not a 3-component array"), *FieldName, Index);
+                return false;
+            }
+            OutVectors[Index] = FVector((*Triple)[0]->AsNumber(), (*Triple)[1]->AsNumber(), (*Triple)[2]->AsNumber());
+        }
+        return true;
+    }
+
+    // Flat array: [x0, y0, z0, x1, y1, z1, ...]
+    if (Values.Num() % 3 != 0)
+    {
+        OutErrorMessage = FString::Printf(TEXT("Field '%s' has %d numbers, expected a multiple of 3"), *FieldName, Values.Num());
+        return false;
+    }
+
+    const int32 Count = Values.Num() / 3;
+    OutVectors.SetNumUninitialized(Count);
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        OutVectors[Index] = FVector(Values[Index * 3]->AsNumber(), Values[Index * 3 + 1]->AsNumber(), Values[Index * 3 + 2]->AsNumber());
+    }
+    return true;
+}
+
+bool FUnrealMCPCommonUtils::GetPackedVectorArrayFromJson(const FUnrealMCPJsonView& JsonObject, const FString& FieldName, TArray<FVector>& OutVectors, FString& OutErrorMessage)
+{
+    OutVectors.Reset();
+
+    const FUnrealMCPJsonView FieldValue = JsonObject.Find(*FieldName);
+    if (!FieldValue.IsValid() || FieldValue.GetType() == EJson::Null)
+    {
+        return true;
+    }
+
+    if (FieldValue.GetType() == EJson::String)
+    {
+        return DecodePackedVectorBase64(FieldValue.AsString(), FieldName, OutVectors, OutErrorMessage);
+    }
+
+    if (!FieldValue.IsArray())
+    {
+        OutErrorMessage = FString::Printf(TEXT("Field '%s' must be a number array or a base64 string"), *FieldName);
+        return false;
+    }
+
+    // Packed float arrays map straight onto flat triples
+    TConstArrayView<float> PackedFloats;
+    if (FieldValue.TryGetFloatArray(PackedFloats))
+    {
+        if (PackedFloats.Num() % 3 != 0)
+        {
+            OutErrorMessage = FString::Printf(TEXT("Field '%s' has %d numbers, expected a multiple of 3"), *FieldName, PackedFloats.Num());
+            return false;
+        }
+
+        const int32 Count = PackedFloats.Num() / 3;
+        OutVectors.SetNumUninitialized(Count);
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            OutVectors[Index] = FVector(PackedFloats[Index * 3], PackedFloats[Index * 3 + 1], PackedFloats[Index * 3 + 2]);
+        }
+        return true;
+    }
+
+    // Same layouts as the FJsonObject overload, read straight off the request tape
+    bool bValid = true;
+    bool bTriples = false;
+    int32 Index = 0;
+    FieldValue.ForEachElement([&](const FUnrealMCPJsonView& Element)
+    {
+        if (!bValid)
+        {
+            return;
+        }
+
+        if (Index == 0)
+        {
+            bTriples = Element.IsArray();
+            OutVectors.Reserve(bTriples ? FieldValue.Num() : FieldValue.Num() / 3);
+        }
+
+        if (bTriples)
+        {
+            if (!Element.IsArray() || Element.Num() < 3)
+            {
+                OutErrorMessage = FString::Printf(TEXT("Field '%s' entry %d is not a 3-component array"), *FieldName, Index);
+                bValid = false;
+                return;
+            }
+
+            int32 Component = 0;
+            FVector& Vector = OutVectors.AddZeroed_GetRef();
+            Element.ForEachElement([&Vector, &Component](const FUnrealMCPJsonView& Value)
+            {
+                if (Component < 3)
+                {
+                    Vector[Component++] = Value.AsNumber();
+                }
+            });
+        }
+        else
+        {
+            if (Index % 3 == 0)
+            {
+                OutVectors.AddZeroed();
+            }
+            OutVectors.Last()[Index % 3] = Element.AsNumber();
+        }
+        ++Index;
+    });
+
+    if (bValid && !bTriples && Index % 3 != 0)
+    {
+        OutErrorMessage = FString::Printf(TEXT("Field '%s' has %d numbers, expected a multiple of 3"), *FieldName, Index);
+        bValid = false;
+    }
+
+    if (!bValid)
+    {
+        OutVectors.Reset();
+    }
+    return bValid;
+}
+
+bool FUnrealMCPCommonUtils::DecodePackedVectorBase64(const FString& Encoded, const FString& FieldName, TArray<FVector>& OutVectors, FString& OutErrorMessage)
+{
+    TArray<uint8> Bytes;
+    if (!FBase64::Decode(Encoded, Bytes))
+    {
+        OutErrorMessage = FString::Printf(TEXT("Field '%s' is not valid base64"), *FieldName);
+        return false;
+    }
+
+    const int32 Stride = 3 * sizeof(float);
+    if (Bytes.Num() % Stride != 0)
+    {
+        OutErrorMessage = FString::Printf(TEXT("Field '%s' holds %d bytes, expected a multiple of %d"), *FieldName, Bytes.Num(), Stride);
+        return false;
+    }
+
+    const int32 Count = Bytes.Num() / Stride;
+    OutVectors.SetNumUninitialized(Count);
+    const uint8* Src = Bytes.GetData();
+    for (int32 Index = 0; Index < Count; ++Index, Src += Stride)
+    {
+        float Components[3];
+        FMemory::Memcpy(Components, Src, Stride);
+        OutVectors[Index] = FVector(Components[0], Components[1], Components[2]);
+    }
+    return true;
+}
+
+TSharedPtr<FJsonValue> FUnrealMCPCommonUtils::PackedFloatArrayToJson(TConstArrayView<float> Values, bool bBinary)
+{
+    if (bBinary)
+    {
+        return MakeShared<FJsonValueString>(FBase64::Encode(reinterpret_cast<const uint8*>(Values.GetData()), Values.Num() * sizeof(float)));
+    }
+
+    TArray<TSharedPtr<FJsonValue>> Elements;
+    Elements.Reserve(Values.Num());
+    for (const float Value : Values)
+    {
+        Elements.Add(MakeShared<FJsonValueNumber>(Value));
+    }
+    return MakeShared<FJsonValueArray>(Elements);
+}
+
 // Blueprint Utilities
 UBlueprint* FUnrealMCPCommonUtils::FindBlueprint(const FString& BlueprintName)
 {
     return FindBlueprintByName(BlueprintName);
 }
 
+UBlueprint* FUnrealMCPCommonUtils::FindBlueprint(const FString& BlueprintName, FString& OutErrorMessage, UClass* BlueprintClass)
+{
+    return FUnrealMCPBlueprintIndex::Find(BlueprintName, BlueprintClass, OutErrorMessage);
+}
+
 UBlueprint* FUnrealMCPCommonUtils::FindBlueprintByName(const FString& BlueprintName)
 {
-    FString AssetPath = TEXT("/Game/Blueprints/") + BlueprintName;
-    return LoadObject<UBlueprint>(nullptr, *AssetPath);
+    FString ErrorMessage;
+    UBlueprint* Blueprint = FUnrealMCPBlueprintIndex::Find(BlueprintName, nullptr, ErrorMessage);
+    if (!Blueprint)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("FindBlueprintByName: %s"), *ErrorMessage);
+    }
+    return Blueprint;
 }
 
 UEdGraph* FUnrealMCPCommonUtils::FindOrCreateEventGraph(UBlueprint* Blueprint)
@@ -260,6 +534,8 @@ UK2Node_VariableGet* FUnrealMCPCommonUtils::CreateVariableGetNode(UEdGraph* Grap
     
     UK2Node_VariableGet* VariableGetNode = NewObject<UK2Node_VariableGet>(Graph);
     
+    // A variable added earlier in the batch only exists on the generated class after a compile
+    FUnrealMCPCompileQueue::EnsureCompiled(Blueprint);
     FName VarName(*VariableName);
     FProperty* Property = FindFProperty<FProperty>(Blueprint->GeneratedClass, VarName);
     
@@ -287,6 +563,8 @@ UK2Node_VariableSet* FUnrealMCPCommonUtils::CreateVariableSetNode(UEdGraph* Grap
     
     UK2Node_VariableSet* VariableSetNode = NewObject<UK2Node_VariableSet>(Graph);
     
+    // A variable added earlier in the batch only exists on the generated class after a compile
+    FUnrealMCPCompileQueue::EnsureCompiled(Blueprint);
     FName VarName(*VariableName);
     FProperty* Property = FindFProperty<FProperty>(Blueprint->GeneratedClass, VarName);
     
@@ -368,38 +646,20 @@ UEdGraphPin* FUnrealMCPCommonUtils::FindPin(UEdGraphNode* Node, const FString& P
     {
         return nullptr;
     }
-    
-    // Log all pins for debugging
-    UE_LOG(LogTemp, Display, TEXT("FindPin: Looking for pin '%s' (Direction: %d) in node '%s'"), 
-           *PinName, (int32)Direction, *Node->GetName());
-    
-    for (UEdGraphPin* Pin : Node->Pins)
-    {
-        UE_LOG(LogTemp, Display, TEXT("  - Available pin: '%s', Direction: %d, Category: %s"), 
-               *Pin->PinName.ToString(), (int32)Pin->Direction, *Pin->PinType.PinCategory.ToString());
-    }
-    
-    // First try exact match
-    for (UEdGraphPin* Pin : Node->Pins)
-    {
-        if (Pin->PinName.ToString() == PinName && (Direction == EGPD_MAX || Pin->Direction == Direction))
-        {
-            UE_LOG(LogTemp, Display, TEXT("  - Found exact matching pin: '%s'"), *Pin->PinName.ToString());
-            return Pin;
-        }
-    }
-    
-    // If no exact match and we're looking for a component reference, try case-insensitive match
-    for (UEdGraphPin* Pin : Node->Pins)
+
+    // FName comparison is case-insensitive, and a name that was never registered cannot be a pin name
+    const FName Name(*PinName, FNAME_Find);
+    if (!Name.IsNone())
     {
-        if (Pin->PinName.ToString().Equals(PinName, ESearchCase::IgnoreCase) && 
-            (Direction == EGPD_MAX || Pin->Direction == Direction))
+        for (UEdGraphPin* Pin : Node->Pins)
         {
-            UE_LOG(LogTemp, Display, TEXT("  - Found case-insensitive matching pin: '%s'"), *Pin->PinName.ToString());
-            return Pin;
+            if (Pin->PinName == Name && (Direction == EGPD_MAX || Pin->Direction == Direction))
+            {
+                return Pin;
+            }
         }
     }
-    
+
     // If we're looking for a component output and didn't find it by name, try to find the first data output pin
     if (Direction == EGPD_Output && Cast<UK2Node_VariableGet>(Node) != nullptr)
     {
@@ -407,13 +667,11 @@ UEdGraphPin* FUnrealMCPCommonUtils::FindPin(UEdGraphNode* Node, const FString& P
         {
             if (Pin->Direction == EGPD_Output && Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec)
             {
-                UE_LOG(LogTemp, Display, TEXT("  - Found fallback data output pin: '%s'"), *Pin->PinName.ToString());
                 return Pin;
             }
         }
     }
-    
-    UE_LOG(LogTemp, Warning, TEXT("  - No matching pin found for '%s'"), *PinName);
+
     return nullptr;
 }
 
@@ -424,33 +682,29 @@ TSharedPtr<FJsonValue> FUnrealMCPCommonUtils::ActorToJson(AActor* Actor)
     {
         return MakeShared<FJsonValueNull>();
     }
-    
-    TSharedPtr<FJsonObject> ActorObject = MakeShared<FJsonObject>();
-    ActorObject->SetStringField(TEXT("name"), Actor->GetName());
-    ActorObject->SetStringField(TEXT("class"), Actor->GetClass()->GetName());
-    
-    FVector Location = Actor->GetActorLocation();
-    TArray<TSharedPtr<FJsonValue>> LocationArray;
-    LocationArray.Add(MakeShared<FJsonValueNumber>(Location.X));
-    LocationArray.Add(MakeShared<FJsonValueNumber>(Location.Y));
-    LocationArray.Add(MakeShared<FJsonValueNumber>(Location.Z));
-    ActorObject->SetArrayField(TEXT("location"), LocationArray);
-    
-    FRotator Rotation = Actor->GetActorRotation();
-    TArray<TSharedPtr<FJsonValue>> RotationArray;
-    RotationArray.Add(MakeShared<FJsonValueNumber>(Rotation.Pitch));
-    RotationArray.Add(MakeShared<FJsonValueNumber>(Rotation.Yaw));
-    RotationArray.Add(MakeShared<FJsonValueNumber>(Rotation.Roll));
-    ActorObject->SetArrayField(TEXT("rotation"), RotationArray);
-    
-    FVector Scale = Actor->GetActorScale3D();
-    TArray<TSharedPtr<FJsonValue>> ScaleArray;
-    ScaleArray.Add(MakeShared<FJsonValueNumber>(Scale.X));
-    ScaleArray.Add(MakeShared<FJsonValueNumber>(Scale.Y));
-    ScaleArray.Add(MakeShared<FJsonValueNumber>(Scale.Z));
-    ActorObject->SetArrayField(TEXT("scale"), ScaleArray);
-    
-    return MakeShared<FJsonValueObject>(ActorObject);
+
+    return MakeShared<FJsonValueObject>(ActorToJsonObject(Actor));
+}
+
+void FUnrealMCPCommonUtils::WriteActorJson(FUnrealMCPJsonWriter& Writer, AActor* Actor)
+{
+    if (!Actor)
+    {
+        Writer.WriteNull();
+        return;
+    }
+
+    // Same fields as ActorToJsonObject, written without building a DOM
+    Writer.BeginObject();
+    Writer.WriteStringField(TEXT("name"), Actor->GetName());
+    Writer.WriteStringField(TEXT("class"), Actor->GetClass()->GetName());
+    Writer.WriteKey(TEXT("location"));
+    Writer.WriteVector(Actor->GetActorLocation());
+    Writer.WriteKey(TEXT("rotation"));
+    Writer.WriteRotator(Actor->GetActorRotation());
+    Writer.WriteKey(TEXT("scale"));
+    Writer.WriteVector(Actor->GetActorScale3D());
+    Writer.EndObject();
 }
 
 TSharedPtr<FJsonObject> FUnrealMCPCommonUtils::ActorToJsonObject(AActor* Actor, bool bDetailed)
@@ -488,6 +742,24 @@ TSharedPtr<FJsonObject> FUnrealMCPCommonUtils::ActorToJsonObject(AActor* Actor,
     return ActorObject;
 }
 
+void FUnrealMCPCommonUtils::BuildActorNameMap(UWorld* World, TMap<FName, AActor*>& OutActorsByName)
+{
+    OutActorsByName.Reset();
+
+    if (!World)
+    {
+        return;
+    }
+
+    for (TActorIterator<AActor> It(World); It; ++It)
+    {
+        if (AActor* Actor = *It)
+        {
+            OutActorsByName.Add(Actor->GetFName(), Actor);
+        }
+    }
+}
+
 UK2Node_Event* FUnrealMCPCommonUtils::FindExistingEventNode(UEdGraph* Graph, const FString& EventName)
 {
     if (!Graph)
@@ -530,81 +802,38 @@ UActorComponent* FUnrealMCPCommonUtils::FindComponentByName(AActor* Actor, const
 bool FUnrealMCPCommonUtils::SetObjectProperty(UObject* Object, const FString& PropertyName, 
                                      const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage)
 {
-    if (!Object)
+    // The path is compiled once per class and cached, see FUnrealMCPPropertyPath
+    FUnrealMCPPropertyPath::FResolved Resolved;
+    if (!FUnrealMCPPropertyPath::Resolve(Object, PropertyName, Resolved, OutErrorMessage))
     {
-        OutErrorMessage = TEXT("Invalid object");
         return false;
     }
 
-    FString CurrentPropertyName = PropertyName; // Create a mutable copy
-    UObject* TargetObject = Object; // The object on which to set the property
+    // Notify the owner as a details panel edit would, so setters in PostEditChangeProperty and
+    // dependent state (render state, construction, archetype propagation) see the new value
+    UObject* Owner = Resolved.Owner;
+    Owner->Modify();
+    Owner->PreEditChange(Resolved.MemberProperty);
 
-    // Check if the property name contains a dot, indicating a component property
-    if (CurrentPropertyName.Contains(TEXT(".")))
-    {
-        FString ComponentNameStr;
-        FString ActualPropertyName;
-        if (CurrentPropertyName.Split(TEXT("."), &ComponentNameStr, &ActualPropertyName))
-        {
-            if (AActor* Actor = Cast<AActor>(Object))
-            {
-                UActorComponent* FoundComponent = nullptr;
-                UE_LOG(LogTemp, Display, TEXT("SetObjectProperty: Searching for component '%s' on actor '%s'"), *ComponentNameStr, *Actor->GetName());
+    const bool bSet = SetPropertyValue(Resolved.Property, Resolved.ValuePtr, Value, OutErrorMessage);
 
-                if (ComponentNameStr == TEXT("StaticMeshComponent"))
-                {
-                    FoundComponent = Actor->FindComponentByClass<UStaticMeshComponent>();
-                    if (FoundComponent)
-                    {
-                        UE_LOG(LogTemp, Display, TEXT("SetObjectProperty: Found StaticMeshComponent by class: '%s'"), *FoundComponent->GetName());
-                    }
-                    else
-                    {
-                        UE_LOG(LogTemp, Warning, TEXT("SetObjectProperty: StaticMeshComponent not found by class."));
-                    }
-                }
-                
-                // Fallback to iterating all components and matching by name
-                if (!FoundComponent)
-                {
-                    for (UActorComponent* ActorComp : Actor->GetComponents())
-                    {
-                        if (ActorComp)
-                        {
-                            UE_LOG(LogTemp, Display, TEXT("SetObjectProperty: Checking component '%s' (Class: %s)"), *ActorComp->GetName(), *ActorComp->GetClass()->GetName());
-                            if (ActorComp->GetName() == ComponentNameStr)
-                            {
-                                FoundComponent = ActorComp;
-                                UE_LOG(LogTemp, Display, TEXT("SetObjectProperty: Found component by name: '%s'"), *FoundComponent->GetName());
-                                break;
-                            }
-                        }
-                    }
-                }
-
-                if (FoundComponent)
-                {
-                    TargetObject = FoundComponent;
-                    CurrentPropertyName = ActualPropertyName; // Assign to mutable copy
-                }
-                else
-                {
-                    OutErrorMessage = FString::Printf(TEXT("Component '%s' not found on actor '%s'"), *ComponentNameStr, *Actor->GetName());
-                    return false;
-                }
-            }
-        }
-    }
+    FPropertyChangedEvent ChangedEvent(Resolved.Property, EPropertyChangeType::ValueSet);
+    ChangedEvent.SetActiveMemberProperty(Resolved.MemberProperty);
+    Owner->PostEditChangeProperty(ChangedEvent);
+    return bSet;
+}
 
-    FProperty* Property = TargetObject->GetClass()->FindPropertyByName(*CurrentPropertyName);
-    if (!Property)
+bool FUnrealMCPCommonUtils::SetPropertyValue(FProperty* Property, void* PropertyAddr,
+                                    const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage)
+{
+    if (!Property || !PropertyAddr || !Value.IsValid())
     {
-        OutErrorMessage = FString::Printf(TEXT("Property not found: %s"), *PropertyName);
+        OutErrorMessage = TEXT("Invalid property or value");
         return false;
     }
 
-    void* PropertyAddr = Property->ContainerPtrToValuePtr<void>(TargetObject);
-    
+    const FString PropertyName = Property->GetName();
+
     // Handle different property types
     if (Property->IsA<FBoolProperty>())
     {
@@ -617,7 +846,7 @@ bool FUnrealMCPCommonUtils::SetObjectProperty(UObject* Object, const FString& Pr
         FIntProperty* IntProperty = CastField<FIntProperty>(Property);
         if (IntProperty)
         {
-            IntProperty->SetPropertyValue_InContainer(Object, IntValue);
+            IntProperty->SetPropertyValue(PropertyAddr, IntValue);
             return true;
         }
     }
@@ -626,11 +855,47 @@ bool FUnrealMCPCommonUtils::SetObjectProperty(UObject* Object, const FString& Pr
         ((FFloatProperty*)Property)->SetPropertyValue(PropertyAddr, Value->AsNumber());
         return true;
     }
+    else if (Property->IsA<FDoubleProperty>())
+    {
+        ((FDoubleProperty*)Property)->SetPropertyValue(PropertyAddr, Value->AsNumber());
+        return true;
+    }
     else if (Property->IsA<FStrProperty>())
     {
         ((FStrProperty*)Property)->SetPropertyValue(PropertyAddr, Value->AsString());
         return true;
     }
+    else if (Property->IsA<FNameProperty>())
+    {
+        ((FNameProperty*)Property)->SetPropertyValue(PropertyAddr, FName(*Value->AsString()));
+        return true;
+    }
+    else if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+    {
+        // Vectors and rotators also accept the [x, y, z] arrays used elsewhere in this API
+        const TArray<TSharedPtr<FJsonValue>>* Components = nullptr;
+        if (Value->TryGetArray(Components) && Components->Num() == 3)
+        {
+            if (StructProperty->Struct == TBaseStructure<FVector>::Get())
+            {
+                *static_cast<FVector*>(PropertyAddr) = FVector((*Components)[0]->AsNumber(), (*Components)[1]->AsNumber(), (*Components)[2]->AsNumber());
+                return true;
+            }
+            if (StructProperty->Struct == TBaseStructure<FRotator>::Get())
+            {
+                *static_cast<FRotator*>(PropertyAddr) = FRotator((*Components)[0]->AsNumber(), (*Components)[1]->AsNumber(), (*Components)[2]->AsNumber());
+                return true;
+            }
+        }
+
+        if (FJsonObjectConverter::JsonValueToUProperty(Value, Property, PropertyAddr, 0, 0))
+        {
+            return true;
+        }
+
+        OutErrorMessage = FString::Printf(TEXT("Failed to convert value for struct property: %s"), *PropertyName);
+        return false;
+    }
     else if (FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Property))
     {
         if (Value->Type == EJson::String)
@@ -799,6 +1064,12 @@ bool FUnrealMCPCommonUtils::SetObjectProperty(UObject* Object, const FString& Pr
         }
     }
     
+    // Anything else (arrays, text, soft references...) goes through the generic converter
+    if (FJsonObjectConverter::JsonValueToUProperty(Value, Property, PropertyAddr, 0, 0))
+    {
+        return true;
+    }
+
     OutErrorMessage = FString::Printf(TEXT("Unsupported property type: %s for property %s"), 
                                     *Property->GetClass()->GetName(), *PropertyName);
     return false;
@@ -0,0 +1,285 @@
+#include "Commands/UnrealMCPCompileQueue.h"
+#include "Commands/UnrealMCPBlueprintHash.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "BlueprintCompilationManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Editor.h"
+
+static TAutoConsoleVariable<int32> CVarBlueprintCompilePolicy(
+    TEXT("UnrealMCP.Blueprint.CompilePolicy"),
+    1,
+    TEXT("When blueprints edited by MCP commands are compiled.\n")
+    TEXT(" 0: immediately after every edit\n")
+    TEXT(" 1: deferred to the end of a batch, an explicit compile_blueprint, or editor idle (default)"));
+
+static TAutoConsoleVariable<float> CVarBlueprintCompileIdleSeconds(
+    TEXT("UnrealMCP.Blueprint.CompileIdleSeconds"),
+    1.0f,
+    TEXT("Seconds without a blueprint edit before deferred compiles run on their own."));
+
+TArray<TWeakObjectPtr<UBlueprint>> FUnrealMCPCompileQueue::Pending;
+TMap<FObjectKey, FUnrealMCPCompileQueue::FCompileRecord> FUnrealMCPCompileQueue::Records;
+double FUnrealMCPCompileQueue::LastDirtyTime = 0.0;
+FTSTicker::FDelegateHandle FUnrealMCPCompileQueue::IdleTickerHandle;
+
+FUnrealMCPCompileQueue::EPolicy FUnrealMCPCompileQueue::GetPolicy()
+{
+    return CVarBlueprintCompilePolicy.GetValueOnGameThread() == 0 ? EPolicy::Immediate : EPolicy::Deferred;
+}
+
+void FUnrealMCPCompileQueue::MarkDirty(UBlueprint* Blueprint)
+{
+    if (!Blueprint)
+    {
+        return;
+    }
+
+    if (GetPolicy() == EPolicy::Immediate)
+    {
+        Compile({ Blueprint });
+        return;
+    }
+
+    Pending.AddUnique(Blueprint);
+    LastDirtyTime = FPlatformTime::Seconds();
+
+    if (!IdleTickerHandle.IsValid())
+    {
+        IdleTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FUnrealMCPCompileQueue::TickIdle), 0.25f);
+    }
+}
+
+void FUnrealMCPCompileQueue::EnsureCompiled(UBlueprint* Blueprint)
+{
+    const int32 Index = Pending.IndexOfByKey(Blueprint);
+    if (Blueprint && Index != INDEX_NONE)
+    {
+        Pending.RemoveAtSwap(Index);
+        Compile({ Blueprint });
+    }
+}
+
+int32 FUnrealMCPCompileQueue::Flush(UBlueprint* AlsoCompile, bool bForce, TArray<UBlueprint*>* OutSkipped)
+{
+    TArray<UBlueprint*> Blueprints;
+    if (AlsoCompile)
+    {
+        Blueprints.Add(AlsoCompile);
+    }
+    for (const TWeakObjectPtr<UBlueprint>& Blueprint : Pending)
+    {
+        if (Blueprint.IsValid())
+        {
+            Blueprints.AddUnique(Blueprint.Get());
+        }
+    }
+    Pending.Reset();
+
+    return Blueprints.Num() > 0 ? Compile(Blueprints, true, bForce, OutSkipped) : 0;
+}
+
+int32 FUnrealMCPCompileQueue::CompileNow(const TArray<UBlueprint*>& Blueprints, bool bIncludeDependents, bool bForce, TArray<UBlueprint*>* OutSkipped)
+{
+    Pending.RemoveAll([&Blueprints](const TWeakObjectPtr<UBlueprint>& Blueprint)
+    {
+        return !Blueprint.IsValid() || Blueprints.Contains(Blueprint.Get());
+    });
+
+    return Blueprints.Num() > 0 ? Compile(Blueprints, bIncludeDependents, bForce, OutSkipped) : 0;
+}
+
+void FUnrealMCPCompileQueue::GetCompilerMessages(UBlueprint* Blueprint, TArray<FString>& OutErrors, TArray<FString>& OutWarnings)
+{
+    if (!Blueprint)
+    {
+        return;
+    }
+
+    // The compiler leaves its messages on the nodes it complained about, which keeps them
+    // attributable per blueprint even when many were compiled in one pass
+    TArray<UEdGraph*> Graphs;
+    Blueprint->GetAllGraphs(Graphs);
+    for (const UEdGraph* Graph : Graphs)
+    {
+        for (const UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (!Node || !Node->bHasCompilerMessage)
+            {
+                continue;
+            }
+
+            const FString Message = FString::Printf(TEXT("%s (%s): %s"),
+                *Node->GetNodeTitle(ENodeTitleType::ListView).ToString(), *Graph->GetName(), *Node->ErrorMsg);
+            if (Node->ErrorType <= EMessageSeverity::Error)
+            {
+                OutErrors.Add(Message);
+            }
+            else if (Node->ErrorType <= EMessageSeverity::Warning)
+            {
+                OutWarnings.Add(Message);
+            }
+        }
+    }
+
+    if (Blueprint->Status == BS_Error && OutErrors.Num() == 0)
+    {
+        OutErrors.Add(TEXT("Blueprint failed to compile; see the compiler results log for details"));
+    }
+}
+
+bool FUnrealMCPCompileQueue::IsPending(const UBlueprint* Blueprint)
+{
+    return Blueprint && Pending.Contains(Blueprint);
+}
+
+int32 FUnrealMCPCompileQueue::NumPending()
+{
+    return Pending.Num();
+}
+
+int32 FUnrealMCPCompileQueue::Compile(const TArray<UBlueprint*>& Blueprints, bool bIncludeDependents, bool bForce, TArray<UBlueprint*>* OutSkipped)
+{
+    TMap<const UBlueprint*, uint64> HashCache;
+    TArray<UBlueprint*> Changed;
+    for (UBlueprint* Blueprint : Blueprints)
+    {
+        if (!bForce && IsUnchangedSinceLastCompile(Blueprint, HashCache))
+        {
+            if (OutSkipped)
+            {
+                OutSkipped->Add(Blueprint);
+            }
+            continue;
+        }
+        Changed.Add(Blueprint);
+    }
+
+    if (Changed.Num() == 0)
+    {
+        UE_LOG(LogTemp, Display, TEXT("UnrealMCP: skipped %d unchanged blueprints"), Blueprints.Num());
+        return 0;
+    }
+
+    // Queue dependents alongside their parents so a change reaches every child in this pass
+    // rather than each one recompiling separately when it is next touched
+    TSet<UBlueprint*> ToCompile;
+    for (UBlueprint* Blueprint : Changed)
+    {
+        ToCompile.Add(Blueprint);
+
+        if (bIncludeDependents)
+        {
+            TArray<UBlueprint*> Dependents;
+            FBlueprintEditorUtils::GetDependentBlueprints(Blueprint, Dependents);
+            ToCompile.Append(Dependents);
+        }
+    }
+
+    for (UBlueprint* Blueprint : ToCompile)
+    {
+        FBlueprintCompilationManager::QueueForCompilation(Blueprint);
+    }
+    FBlueprintCompilationManager::FlushCompilationQueueAndReinstance();
+
+    // Remember what each successful compile saw; hashes from before the compile are stale now
+    HashCache.Reset();
+    for (UBlueprint* Blueprint : ToCompile)
+    {
+        if (Blueprint->Status == BS_Error)
+        {
+            Records.Remove(FObjectKey(Blueprint));
+            continue;
+        }
+
+        FCompileRecord& Record = Records.FindOrAdd(FObjectKey(Blueprint));
+        Record.StructureHash = GetStructureHash(Blueprint, HashCache);
+        Record.DependencyHash = GetDependencyHash(Blueprint, HashCache);
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("UnrealMCP: compiled %d blueprints (%d edited, %d unchanged skipped)"),
+        ToCompile.Num(), Changed.Num(), Blueprints.Num() - Changed.Num());
+    return ToCompile.Num();
+}
+
+bool FUnrealMCPCompileQueue::IsUnchangedSinceLastCompile(UBlueprint* Blueprint, TMap<const UBlueprint*, uint64>& HashCache)
+{
+    const FCompileRecord* Record = Records.Find(FObjectKey(Blueprint));
+    if (!Record || !Blueprint->GeneratedClass || Blueprint->Status == BS_Error)
+    {
+        return false;
+    }
+
+    return Record->StructureHash == GetStructureHash(Blueprint, HashCache) &&
+           Record->DependencyHash == GetDependencyHash(Blueprint, HashCache);
+}
+
+uint64 FUnrealMCPCompileQueue::GetStructureHash(const UBlueprint* Blueprint, TMap<const UBlueprint*, uint64>& HashCache)
+{
+    if (const uint64* Cached = HashCache.Find(Blueprint))
+    {
+        return *Cached;
+    }
+    const uint64 Hash = FUnrealMCPBlueprintHash::Compute(Blueprint);
+    HashCache.Add(Blueprint, Hash);
+    return Hash;
+}
+
+uint64 FUnrealMCPCompileQueue::GetDependencyHash(UBlueprint* Blueprint, TMap<const UBlueprint*, uint64>& HashCache)
+{
+    // Upstream means blueprint parents plus whatever the blueprint's graphs reference
+    TSet<const UBlueprint*> Upstream;
+    for (const UClass* Class = Blueprint->ParentClass; Class; Class = Class->GetSuperClass())
+    {
+        if (const UBlueprint* ParentBlueprint = UBlueprint::GetBlueprintFromClass(Class))
+        {
+            Upstream.Add(ParentBlueprint);
+        }
+    }
+    FBlueprintEditorUtils::EnsureCachedDependenciesUpToDate(Blueprint);
+    for (const TWeakObjectPtr<UBlueprint>& Dependency : Blueprint->CachedDependencies)
+    {
+        if (Dependency.IsValid() && Dependency.Get() != Blueprint)
+        {
+            Upstream.Add(Dependency.Get());
+        }
+    }
+
+    uint64 Hash = 0;
+    for (const UBlueprint* Dependency : Upstream)
+    {
+        Hash += GetStructureHash(Dependency, HashCache) ^ GetTypeHash(Dependency->GetPathName());
+    }
+    return Hash;
+}
+
+bool FUnrealMCPCompileQueue::TickIdle(float DeltaTime)
+{
+    if (Pending.Num() == 0)
+    {
+        IdleTickerHandle.Reset();
+        return false;
+    }
+
+    // Hold off while edits are still arriving or a play session is running
+    const double IdleSeconds = CVarBlueprintCompileIdleSeconds.GetValueOnGameThread();
+    if (FPlatformTime::Seconds() - LastDirtyTime < IdleSeconds || (GEditor && GEditor->PlayWorld))
+    {
+        return true;
+    }
+
+    Flush();
+    IdleTickerHandle.Reset();
+    return false;
+}
+
+void FUnrealMCPCompileQueue::StopIdleTicker()
+{
+    if (IdleTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(IdleTickerHandle);
+        IdleTickerHandle.Reset();
+    }
+}
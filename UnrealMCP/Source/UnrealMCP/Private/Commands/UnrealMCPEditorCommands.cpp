@@ -1,5 +1,11 @@
 #include "Commands/UnrealMCPEditorCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "Commands/UnrealMCPCompileQueue.h"
+#include "Commands/UnrealMCPFunctionIndex.h"
+#include "Commands/UnrealMCPClassSchema.h"
+#include "Commands/UnrealMCPPropertyPath.h"
+#include "UnrealMCPJsonWriter.h"
+#include "UnrealMCPJsonDocument.h"
 #include "Editor.h"
 #include "EditorAssetLibrary.h"
 #include "EditorViewportClient.h"
@@ -25,6 +31,7 @@
 #include "EngineUtils.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Components/PrimitiveComponent.h"
+#include "ScopedTransaction.h"
 
 FUnrealMCPEditorCommands::FUnrealMCPEditorCommands()
 {
@@ -65,6 +72,10 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleCommand(const FString& C
     {
         return HandleSetActorProperty(Params);
     }
+    else if (CommandType == TEXT("set_property_bulk"))
+    {
+        return HandleSetPropertyBulk(Params);
+    }
     else if (CommandType == TEXT("create_dynamic_material_instance"))
     {
         return HandleCreateDynamicMaterialInstance(Params);
@@ -99,6 +110,92 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleCommand(const FString& C
     return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown editor command: %s"), *CommandType));
 }
 
+bool FUnrealMCPEditorCommands::IsStreamingCommand(const FString& CommandType)
+{
+    return CommandType == TEXT("get_actors_in_level") ||
+           CommandType == TEXT("find_actors_by_name");
+}
+
+bool FUnrealMCPEditorCommands::IsViewCommand(const FString& CommandType)
+{
+    return CommandType == TEXT("set_actor_transforms");
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleViewCommand(const FString& CommandType, const FUnrealMCPJsonView& Params)
+{
+    if (CommandType == TEXT("set_actor_transforms"))
+    {
+        return HandleSetActorTransforms(Params);
+    }
+
+    return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown editor command: %s"), *CommandType));
+}
+
+bool FUnrealMCPEditorCommands::StreamCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, FUnrealMCPJsonWriter& Writer, FString& OutErrorMessage)
+{
+    if (CommandType == TEXT("get_actors_in_level"))
+    {
+        return StreamGetActorsInLevel(Params, Writer, OutErrorMessage);
+    }
+    else if (CommandType == TEXT("find_actors_by_name"))
+    {
+        return StreamFindActorsByName(Params, Writer, OutErrorMessage);
+    }
+
+    OutErrorMessage = FString::Printf(TEXT("Command does not support streaming: %s"), *CommandType);
+    return false;
+}
+
+bool FUnrealMCPEditorCommands::StreamGetActorsInLevel(const TSharedPtr<FJsonObject>& Params, FUnrealMCPJsonWriter& Writer, FString& OutErrorMessage)
+{
+    if (!GWorld)
+    {
+        OutErrorMessage = TEXT("No world loaded");
+        return false;
+    }
+
+    Writer.BeginObject();
+    Writer.WriteKey(TEXT("actors"));
+    Writer.BeginArray();
+    for (TActorIterator<AActor> It(GWorld); It; ++It)
+    {
+        FUnrealMCPCommonUtils::WriteActorJson(Writer, *It);
+    }
+    Writer.EndArray();
+    Writer.EndObject();
+    return true;
+}
+
+bool FUnrealMCPEditorCommands::StreamFindActorsByName(const TSharedPtr<FJsonObject>& Params, FUnrealMCPJsonWriter& Writer, FString& OutErrorMessage)
+{
+    FString Pattern;
+    if (!Params->TryGetStringField(TEXT("pattern"), Pattern))
+    {
+        OutErrorMessage = TEXT("Missing 'pattern' parameter");
+        return false;
+    }
+
+    if (!GWorld)
+    {
+        OutErrorMessage = TEXT("No world loaded");
+        return false;
+    }
+
+    Writer.BeginObject();
+    Writer.WriteKey(TEXT("actors"));
+    Writer.BeginArray();
+    for (TActorIterator<AActor> It(GWorld); It; ++It)
+    {
+        if (It->GetName().Contains(Pattern))
+        {
+            FUnrealMCPCommonUtils::WriteActorJson(Writer, *It);
+        }
+    }
+    Writer.EndArray();
+    Writer.EndObject();
+    return true;
+}
+
 TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleGetActorsInLevel(const TSharedPtr<FJsonObject>& Params)
 {
     TArray<AActor*> AllActors;
@@ -179,7 +276,18 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSpawnActor(const TShared
         Scale = FUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("scale"));
     }
 
-    // Create the actor based on type
+    // Any concrete actor class, by short, prefixed or /Script path name
+    FString ClassError;
+    UClass* ActorClass = FUnrealMCPFunctionIndex::FindClass(ActorType, ClassError, AActor::StaticClass());
+    if (!ActorClass)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown actor type: %s (%s)"), *ActorType, *ClassError));
+    }
+    if (!FUnrealMCPFunctionIndex::IsSpawnable(ActorClass))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor type cannot be placed in a level: %s"), *ActorClass->GetName()));
+    }
+
     AActor* NewActor = nullptr;
     UWorld* World = GEditor->GetEditorWorldContext().World();
 
@@ -212,14 +320,15 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSpawnActor(const TShared
     FActorSpawnParameters SpawnParams;
     SpawnParams.Name = *ActorName;
 
-    if (ActorType == TEXT("StaticMeshActor"))
+    NewActor = World->SpawnActor(ActorClass, &Location, &Rotation, SpawnParams);
+
+    if (AStaticMeshActor* StaticMeshActor = Cast<AStaticMeshActor>(NewActor))
     {
-        NewActor = World->SpawnActor<AStaticMeshActor>(AStaticMeshActor::StaticClass(), Location, Rotation, SpawnParams);
-        if (AStaticMeshActor* StaticMeshActor = Cast<AStaticMeshActor>(NewActor))
+        if (UStaticMeshComponent* StaticMeshComp = StaticMeshActor->GetStaticMeshComponent())
         {
-            if (UStaticMeshComponent* StaticMeshComp = StaticMeshActor->GetStaticMeshComponent())
+            // A bare static mesh actor gets the default cube so it is visible
+            if (!StaticMeshComp->GetStaticMesh())
             {
-                // Load the default cube mesh at runtime
                 UStaticMesh* CubeMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
                 if (CubeMesh)
                 {
@@ -229,44 +338,24 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSpawnActor(const TShared
                 {
                     UE_LOG(LogTemp, Warning, TEXT("Failed to load default cube mesh: /Engine/BasicShapes/Cube.Cube"));
                 }
+            }
 
-                // Set material if provided
-                FString MaterialPath;
-                if (Params->TryGetStringField(TEXT("material"), MaterialPath))
+            // Set material if provided
+            FString MaterialPath;
+            if (Params->TryGetStringField(TEXT("material"), MaterialPath))
+            {
+                UMaterialInterface* Material = Cast<UMaterialInterface>(UEditorAssetLibrary::LoadAsset(MaterialPath));
+                if (Material)
                 {
-                    UMaterialInterface* Material = Cast<UMaterialInterface>(UEditorAssetLibrary::LoadAsset(MaterialPath));
-                    if (Material)
-                    {
-                        StaticMeshComp->SetMaterial(0, Material);
-                    }
-                    else
-                    {
-                        UE_LOG(LogTemp, Warning, TEXT("Failed to load material: %s"), *MaterialPath);
-                    }
+                    StaticMeshComp->SetMaterial(0, Material);
+                }
+                else
+                {
+                    UE_LOG(LogTemp, Warning, TEXT("Failed to load material: %s"), *MaterialPath);
                 }
             }
         }
     }
-    else if (ActorType == TEXT("PointLight"))
-    {
-        NewActor = World->SpawnActor<APointLight>(APointLight::StaticClass(), Location, Rotation, SpawnParams);
-    }
-    else if (ActorType == TEXT("SpotLight"))
-    {
-        NewActor = World->SpawnActor<ASpotLight>(ASpotLight::StaticClass(), Location, Rotation, SpawnParams);
-    }
-    else if (ActorType == TEXT("DirectionalLight"))
-    {
-        NewActor = World->SpawnActor<ADirectionalLight>(ADirectionalLight::StaticClass(), Location, Rotation, SpawnParams);
-    }
-    else if (ActorType == TEXT("CameraActor"))
-    {
-        NewActor = World->SpawnActor<ACameraActor>(ACameraActor::StaticClass(), Location, Rotation, SpawnParams);
-    }
-    else
-    {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown actor type: %s"), *ActorType));
-    }
 
     if (NewActor)
     {
@@ -363,6 +452,96 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSetActorTransform(const
     return FUnrealMCPCommonUtils::ActorToJsonObject(TargetActor, true);
 }
 
+TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSetActorTransforms(const FUnrealMCPJsonView& Params)
+{
+    // Actor ids, one per transform
+    FUnrealMCPJsonView ActorNameArray;
+    if (!Params.TryGetArrayField(TEXT("actors"), ActorNameArray))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'actors' parameter"));
+    }
+
+    // Structure-of-arrays transform data. Each column is optional; missing
+    // columns keep the actor's current value.
+    TArray<FVector> Locations;
+    TArray<FVector> Rotations;
+    TArray<FVector> Scales;
+    FString ErrorMessage;
+    if (!FUnrealMCPCommonUtils::GetPackedVectorArrayFromJson(Params, TEXT("locations"), Locations, ErrorMessage) ||
+        !FUnrealMCPCommonUtils::GetPackedVectorArrayFromJson(Params, TEXT("rotations"), Rotations, ErrorMessage) ||
+        !FUnrealMCPCommonUtils::GetPackedVectorArrayFromJson(Params, TEXT("scales"), Scales, ErrorMessage))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+    }
+
+    // Names point into the request document, so no per-actor string copies are made
+    TArray<FStringView> ActorNames;
+    ActorNames.Reserve(ActorNameArray.Num());
+    ActorNameArray.ForEachElement([&ActorNames](const FUnrealMCPJsonView& Value)
+    {
+        ActorNames.Add(Value.AsStringView());
+    });
+
+    const int32 Count = ActorNames.Num();
+    if ((Locations.Num() > 0 && Locations.Num() != Count) ||
+        (Rotations.Num() > 0 && Rotations.Num() != Count) ||
+        (Scales.Num() > 0 && Scales.Num() != Count))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(
+            TEXT("Array length mismatch: %d actors, %d locations, %d rotations, %d scales"),
+            Count, Locations.Num(), Rotations.Num(), Scales.Num()));
+    }
+
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
+    // Resolve every actor through a single pass over the level
+    TMap<FName, AActor*> ActorsByName;
+    FUnrealMCPCommonUtils::BuildActorNameMap(World, ActorsByName);
+
+    int32 UpdatedCount = 0;
+    TArray<TSharedPtr<FJsonValue>> MissingActors;
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        const FStringView ActorName = ActorNames[Index];
+        const FName ActorFName(ActorName, FNAME_Find);
+        AActor** FoundActor = ActorFName.IsNone() ? nullptr : ActorsByName.Find(ActorFName);
+        if (!FoundActor || !*FoundActor)
+        {
+            MissingActors.Add(MakeShared<FJsonValueString>(FString(ActorName)));
+            continue;
+        }
+
+        AActor* Actor = *FoundActor;
+        FTransform NewTransform = Actor->GetActorTransform();
+        if (Locations.Num() > 0)
+        {
+            NewTransform.SetLocation(Locations[Index]);
+        }
+        if (Rotations.Num() > 0)
+        {
+            const FVector& Rotation = Rotations[Index];
+            NewTransform.SetRotation(FQuat(FRotator(Rotation.X, Rotation.Y, Rotation.Z)));
+        }
+        if (Scales.Num() > 0)
+        {
+            NewTransform.SetScale3D(Scales[Index]);
+        }
+
+        // One transform write per actor, so components update and mark render state dirty once
+        Actor->SetActorTransform(NewTransform, false, nullptr, ETeleportType::TeleportPhysics);
+        ++UpdatedCount;
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetNumberField(TEXT("updated"), UpdatedCount);
+    ResultObj->SetArrayField(TEXT("missing_actors"), MissingActors);
+    return ResultObj;
+}
+
 TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleGetActorProperties(const TSharedPtr<FJsonObject>& Params)
 {
     // Get actor name
@@ -391,8 +570,52 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleGetActorProperties(const
         return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
     }
 
-    // Always return detailed properties for this command
-    return FUnrealMCPCommonUtils::ActorToJsonObject(TargetActor, true);
+    // Optional filters
+    FString CategoryFilter;
+    Params->TryGetStringField(TEXT("category"), CategoryFilter);
+
+    FString NamePattern;
+    Params->TryGetStringField(TEXT("name_pattern"), NamePattern);
+
+    bool bIncludeComponents = false;
+    Params->TryGetBoolField(TEXT("include_components"), bIncludeComponents);
+
+    TSharedPtr<FJsonObject> ResultObj = FUnrealMCPCommonUtils::ActorToJsonObject(TargetActor, true);
+
+    // Property values come from the cached per-class plan
+    TSharedPtr<FJsonObject> PropertiesObj = MakeShared<FJsonObject>();
+    if (TSharedPtr<const FUnrealMCPClassSchema> Schema = FUnrealMCPClassSchema::Get(TargetActor->GetClass()))
+    {
+        Schema->SerializeObject(TargetActor, CategoryFilter, NamePattern, PropertiesObj);
+    }
+    ResultObj->SetObjectField(TEXT("properties"), PropertiesObj);
+
+    if (bIncludeComponents)
+    {
+        TArray<TSharedPtr<FJsonValue>> ComponentArray;
+        for (UActorComponent* Component : TargetActor->GetComponents())
+        {
+            if (!Component)
+            {
+                continue;
+            }
+
+            TSharedPtr<FJsonObject> ComponentObj = MakeShared<FJsonObject>();
+            ComponentObj->SetStringField(TEXT("name"), Component->GetName());
+            ComponentObj->SetStringField(TEXT("class"), Component->GetClass()->GetName());
+
+            TSharedPtr<FJsonObject> ComponentProperties = MakeShared<FJsonObject>();
+            if (TSharedPtr<const FUnrealMCPClassSchema> Schema = FUnrealMCPClassSchema::Get(Component->GetClass()))
+            {
+                Schema->SerializeObject(Component, CategoryFilter, NamePattern, ComponentProperties);
+            }
+            ComponentObj->SetObjectField(TEXT("properties"), ComponentProperties);
+            ComponentArray.Add(MakeShared<FJsonValueObject>(ComponentObj));
+        }
+        ResultObj->SetArrayField(TEXT("components"), ComponentArray);
+    }
+
+    return ResultObj;
 }
 
 TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSetActorProperty(const TSharedPtr<FJsonObject>& Params)
@@ -495,6 +718,242 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSetActorProperty(const T
     }
 }
 
+TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSetPropertyBulk(const TSharedPtr<FJsonObject>& Params)
+{
+    // Get required parameters
+    FString PropertyPath;
+    if (!Params->TryGetStringField(TEXT("property"), PropertyPath))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'property' parameter"));
+    }
+
+    // One value for every actor, or per-actor values: an array in the order of selector.actors,
+    // or an object keyed by actor name
+    TSharedPtr<FJsonValue> SharedValue = Params->TryGetField(TEXT("value"));
+    const TArray<TSharedPtr<FJsonValue>>* PerActorValues = nullptr;
+    const TSharedPtr<FJsonObject>* ValuesByActor = nullptr;
+    if (!Params->TryGetArrayField(TEXT("values"), PerActorValues))
+    {
+        Params->TryGetObjectField(TEXT("values"), ValuesByActor);
+    }
+    if (!SharedValue.IsValid() && !PerActorValues && !ValuesByActor)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'value' or 'values' parameter"));
+    }
+
+    // Selector fields all narrow the match; an empty selector matches every actor
+    const TSharedPtr<FJsonObject>* SelectorObj = nullptr;
+    if (!Params->TryGetObjectField(TEXT("selector"), SelectorObj))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'selector' parameter"));
+    }
+    const TSharedPtr<FJsonObject>& Selector = *SelectorObj;
+
+    FString ClassName;
+    Selector->TryGetStringField(TEXT("class"), ClassName);
+
+    FString TagString;
+    Selector->TryGetStringField(TEXT("tag"), TagString);
+    const FName Tag = TagString.IsEmpty() ? NAME_None : FName(*TagString);
+
+    FString NamePattern;
+    Selector->TryGetStringField(TEXT("name_pattern"), NamePattern);
+
+    const bool bUseBox = Selector->HasField(TEXT("box_min")) && Selector->HasField(TEXT("box_max"));
+    FBox Box(ForceInit);
+    if (bUseBox)
+    {
+        const FVector BoxMin = FUnrealMCPCommonUtils::GetVectorFromJson(Selector, TEXT("box_min"));
+        const FVector BoxMax = FUnrealMCPCommonUtils::GetVectorFromJson(Selector, TEXT("box_max"));
+        Box = FBox(BoxMin.ComponentMin(BoxMax), BoxMin.ComponentMax(BoxMax));
+    }
+
+    // Explicit actors, remembering the caller's order
+    TMap<FName, int32> ActorNames;
+    const TArray<TSharedPtr<FJsonValue>>* ActorNameArray = nullptr;
+    if (Selector->TryGetArrayField(TEXT("actors"), ActorNameArray))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *ActorNameArray)
+        {
+            ActorNames.FindOrAdd(FName(*Value->AsString()), ActorNames.Num());
+        }
+    }
+    if (PerActorValues && !ActorNameArray)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("A 'values' array needs an explicit 'selector.actors' list to pair with; use an object keyed by actor name otherwise"));
+    }
+
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
+    // Class matches are decided once per class, not once per actor
+    TMap<UClass*, bool> ClassMatches;
+    auto MatchesClass = [&ClassMatches, &ClassName](UClass* ActorClass)
+    {
+        if (const bool* Cached = ClassMatches.Find(ActorClass))
+        {
+            return *Cached;
+        }
+
+        bool bMatches = false;
+        for (UClass* Class = ActorClass; Class && !bMatches; Class = Class->GetSuperClass())
+        {
+            bMatches = Class->GetName() == ClassName || Class->GetPathName() == ClassName;
+        }
+        ClassMatches.Add(ActorClass, bMatches);
+        return bMatches;
+    };
+
+    TArray<AActor*> Selected;
+    for (TActorIterator<AActor> It(World); It; ++It)
+    {
+        AActor* Actor = *It;
+        if (!Actor ||
+            (ActorNames.Num() > 0 && !ActorNames.Contains(Actor->GetFName())) ||
+            (!ClassName.IsEmpty() && !MatchesClass(Actor->GetClass())) ||
+            (!Tag.IsNone() && !Actor->ActorHasTag(Tag)) ||
+            (!NamePattern.IsEmpty() && !Actor->GetName().MatchesWildcard(NamePattern) && !Actor->GetActorLabel().MatchesWildcard(NamePattern)) ||
+            (bUseBox && !Box.IsInside(Actor->GetActorLocation())))
+        {
+            continue;
+        }
+        Selected.Add(Actor);
+    }
+
+    // A values array pairs with selector.actors in the caller's order, so every listed actor must match
+    if (PerActorValues)
+    {
+        if (PerActorValues->Num() != ActorNames.Num())
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(
+                TEXT("%d actors were listed but %d values were given"), ActorNames.Num(), PerActorValues->Num()));
+        }
+        if (Selected.Num() != ActorNames.Num())
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(
+                TEXT("Selector matched %d of the %d listed actors"), Selected.Num(), ActorNames.Num()));
+        }
+        Selected.Sort([&ActorNames](const AActor& A, const AActor& B) { return ActorNames[A.GetFName()] < ActorNames[B.GetFName()]; });
+    }
+
+    // A values object must name exactly the selected actors
+    if (ValuesByActor)
+    {
+        TArray<FString> Unmatched;
+        for (const AActor* Actor : Selected)
+        {
+            if (!(*ValuesByActor)->HasField(Actor->GetName()))
+            {
+                Unmatched.Add(Actor->GetName());
+            }
+        }
+        if (Unmatched.Num() > 0 || (*ValuesByActor)->Values.Num() != Selected.Num())
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(
+                TEXT("Selector matched %d actors but %d values were given; actors without a value: %s"),
+                Selected.Num(), (*ValuesByActor)->Values.Num(), *FString::Join(Unmatched, TEXT(", "))));
+        }
+    }
+
+    // Resolve every target before writing anything; the compiled path is cached per class
+    struct FBulkTarget
+    {
+        AActor* Actor;
+        FUnrealMCPPropertyPath::FResolved Resolved;
+        TSharedPtr<FJsonValue> Value;
+    };
+
+    TArray<FBulkTarget> Targets;
+    Targets.Reserve(Selected.Num());
+    TArray<TSharedPtr<FJsonValue>> Failed;
+    for (int32 Index = 0; Index < Selected.Num(); ++Index)
+    {
+        FBulkTarget Target;
+        Target.Actor = Selected[Index];
+        Target.Value = PerActorValues ? (*PerActorValues)[Index]
+            : ValuesByActor ? (*ValuesByActor)->TryGetField(Target.Actor->GetName())
+            : SharedValue;
+
+        FString ErrorMessage;
+        if (!FUnrealMCPPropertyPath::Resolve(Target.Actor, PropertyPath, Target.Resolved, ErrorMessage))
+        {
+            TSharedPtr<FJsonObject> FailedObj = MakeShared<FJsonObject>();
+            FailedObj->SetStringField(TEXT("actor"), Target.Actor->GetName());
+            FailedObj->SetStringField(TEXT("error"), ErrorMessage);
+            Failed.Add(MakeShared<FJsonValueObject>(FailedObj));
+            continue;
+        }
+        Targets.Add(Target);
+    }
+
+    // One transaction and one PreEditChange/PostEditChangeProperty per owning object,
+    // however many values land in it
+    TArray<UObject*> Owners;
+    TMap<UObject*, FProperty*> OwnerMemberProperty;
+    for (const FBulkTarget& Target : Targets)
+    {
+        if (!OwnerMemberProperty.Contains(Target.Resolved.Owner))
+        {
+            Owners.Add(Target.Resolved.Owner);
+            OwnerMemberProperty.Add(Target.Resolved.Owner, Target.Resolved.MemberProperty);
+        }
+    }
+
+    int32 UpdatedCount = 0;
+    {
+        const FScopedTransaction Transaction(FText::FromString(FString::Printf(TEXT("Set %s on %d actors"), *PropertyPath, Targets.Num())));
+
+        for (UObject* Owner : Owners)
+        {
+            Owner->Modify();
+            Owner->PreEditChange(OwnerMemberProperty[Owner]);
+        }
+
+        for (const FBulkTarget& Target : Targets)
+        {
+            FString ErrorMessage;
+            if (FUnrealMCPCommonUtils::SetPropertyValue(Target.Resolved.Property, Target.Resolved.ValuePtr, Target.Value, ErrorMessage))
+            {
+                ++UpdatedCount;
+            }
+            else
+            {
+                TSharedPtr<FJsonObject> FailedObj = MakeShared<FJsonObject>();
+                FailedObj->SetStringField(TEXT("actor"), Target.Actor->GetName());
+                FailedObj->SetStringField(TEXT("error"), ErrorMessage);
+                Failed.Add(MakeShared<FJsonValueObject>(FailedObj));
+            }
+        }
+
+        for (UObject* Owner : Owners)
+        {
+            FProperty* MemberProperty = OwnerMemberProperty[Owner];
+            FPropertyChangedEvent ChangedEvent(MemberProperty, EPropertyChangeType::ValueSet);
+            Owner->PostEditChangeProperty(ChangedEvent);
+        }
+    }
+
+    // Viewports are redrawn once for the whole batch
+    GEditor->RedrawLevelEditingViewports();
+
+    TArray<TSharedPtr<FJsonValue>> ActorArray;
+    for (AActor* Actor : Selected)
+    {
+        ActorArray.Add(MakeShared<FJsonValueString>(Actor->GetName()));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("property"), PropertyPath);
+    ResultObj->SetNumberField(TEXT("matched"), Selected.Num());
+    ResultObj->SetNumberField(TEXT("updated"), UpdatedCount);
+    ResultObj->SetArrayField(TEXT("actors"), ActorArray);
+    ResultObj->SetArrayField(TEXT("failed"), Failed);
+    return ResultObj;
+}
+
 TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSpawnBlueprintActor(const TSharedPtr<FJsonObject>& Params)
 {
     // Get required parameters
@@ -516,22 +975,11 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSpawnBlueprintActor(cons
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Blueprint name is empty"));
     }
 
-    FString Root      = TEXT("/Game/Blueprints/");
-    FString AssetPath = Root + BlueprintName;
-
-    // Check if the asset exists in the Asset Registry
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-    FAssetData AssetData = AssetRegistryModule.Get().GetAssetByObjectPath(FSoftObjectPath(AssetPath));
-
-    if (!AssetData.IsValid())
-    {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint '%s' not found in Asset Registry at path '%s'"), *BlueprintName, *AssetPath));
-    }
-
-    UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *AssetPath);
+    FString FindError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, FindError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FindError);
     }
 
     // Get transform parameters
@@ -588,6 +1036,7 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSpawnBlueprintActor(cons
     FActorSpawnParameters SpawnParams;
     SpawnParams.Name = *ActorName;
 
+    FUnrealMCPCompileQueue::EnsureCompiled(Blueprint);
     AActor* NewActor = World->SpawnActor<AActor>(Blueprint->GeneratedClass, SpawnTransform, SpawnParams);
     if (NewActor)
     {
@@ -922,15 +1371,16 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSetMaterialOnComponent(c
     }
 
     // 2. Cargar el Blueprint
-    FString BPPath = TEXT("/Game/Blueprints/") + BlueprintName + TEXT(".") + BlueprintName;
-    UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BPPath);
+    FString FindError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, FindError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to load Blueprint: %s"), *BPPath));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FindError);
     }
 
     // 3. Encontrar el componente en el Blueprint
     // Get the CDO (Class Default Object) of the Blueprint's generated class
+    FUnrealMCPCompileQueue::EnsureCompiled(Blueprint);
     AActor* DefaultActor = Cast<AActor>(Blueprint->GeneratedClass->GetDefaultObject());
     UActorComponent* Component = nullptr;
 
@@ -0,0 +1,344 @@
+#include "Commands/UnrealMCPFunctionIndex.h"
+#include "Commands/UnrealMCPApiSearch.h"
+#include "Commands/UnrealMCPBlueprintIndex.h"
+#include "Commands/UnrealMCPCompileQueue.h"
+#include "Engine/Blueprint.h"
+#include "GameFramework/Actor.h"
+#include "Components/ActorComponent.h"
+#include "UObject/Class.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/UObjectIterator.h"
+
+// How long each editor tick may spend walking classes while the index builds in the background
+static constexpr double FunctionIndexTickBudgetSeconds = 0.002;
+
+TArray<TWeakObjectPtr<UClass>> FUnrealMCPFunctionIndex::PendingClasses;
+TMap<FName, TArray<TWeakObjectPtr<UClass>>> FUnrealMCPFunctionIndex::ClassesByName;
+TMap<FName, TArray<FUnrealMCPFunctionIndex::FFunctionEntry>> FUnrealMCPFunctionIndex::FunctionsByName;
+FTSTicker::FDelegateHandle FUnrealMCPFunctionIndex::BuildTickerHandle;
+bool FUnrealMCPFunctionIndex::bStarted = false;
+
+void FUnrealMCPFunctionIndex::StartBuild()
+{
+    if (bStarted)
+    {
+        return;
+    }
+    bStarted = true;
+
+    Rebuild();
+}
+
+void FUnrealMCPFunctionIndex::StopBuild()
+{
+    if (BuildTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(BuildTickerHandle);
+        BuildTickerHandle.Reset();
+    }
+    PendingClasses.Reset();
+    bStarted = false;
+}
+
+bool FUnrealMCPFunctionIndex::IsSpawnable(const UClass* Class)
+{
+    if (!Class)
+    {
+        return false;
+    }
+    if (Class->IsChildOf(AActor::StaticClass()))
+    {
+        return !Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NotPlaceable);
+    }
+    if (Class->IsChildOf(UActorComponent::StaticClass()))
+    {
+        return !Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated);
+    }
+    return false;
+}
+
+UClass* FUnrealMCPFunctionIndex::FindClass(const FString& ClassName, FString& OutErrorMessage, UClass* RequiredBase)
+{
+    EnsureBuilt();
+
+    auto CheckBase = [&ClassName, &OutErrorMessage, RequiredBase](UClass* Class) -> UClass*
+    {
+        if (RequiredBase && !Class->IsChildOf(RequiredBase))
+        {
+            OutErrorMessage = FString::Printf(TEXT("Class '%s' is not a %s"), *ClassName, *RequiredBase->GetName());
+            return nullptr;
+        }
+        return Class;
+    };
+
+    if (ClassName.StartsWith(TEXT("/")))
+    {
+        UClass* Class = FindObject<UClass>(nullptr, *ClassName);
+        if (!Class)
+        {
+            Class = LoadObject<UClass>(nullptr, *ClassName);
+        }
+        if (Class)
+        {
+            return CheckBase(Class);
+        }
+    }
+    else
+    {
+        // Reflected names carry no prefix, and component targets are often given without their suffix
+        TArray<FString> Candidates = { ClassName };
+        if (ClassName.Len() > 1 && (ClassName[0] == TEXT('U') || ClassName[0] == TEXT('A') || ClassName[0] == TEXT('I')) && FChar::IsUpper(ClassName[1]))
+        {
+            Candidates.Add(ClassName.RightChop(1));
+        }
+        for (int32 Index = 0, Num = Candidates.Num(); Index < Num; ++Index)
+        {
+            if (!Candidates[Index].EndsWith(TEXT("Component")))
+            {
+                Candidates.Add(Candidates[Index] + TEXT("Component"));
+            }
+        }
+
+        for (const FString& Candidate : Candidates)
+        {
+            // FNAME_Find: a name nobody has used cannot be a class, and need not be added to the name table
+            const FName CandidateName(*Candidate, FNAME_Find);
+            const TArray<TWeakObjectPtr<UClass>>* Classes = CandidateName.IsNone() ? nullptr : ClassesByName.Find(CandidateName);
+            if (!Classes)
+            {
+                continue;
+            }
+
+            TArray<FString> Paths;
+            UClass* Found = nullptr;
+            for (const TWeakObjectPtr<UClass>& Class : *Classes)
+            {
+                // A name shared across bases (PointLight, PointLightComponent) resolves to the wanted kind
+                if (Class.IsValid() && (!RequiredBase || Class->IsChildOf(RequiredBase)))
+                {
+                    Found = Class.Get();
+                    Paths.Add(Found->GetPathName());
+                }
+            }
+            if (Paths.Num() == 1)
+            {
+                return Found;
+            }
+            if (Paths.Num() > 1)
+            {
+                OutErrorMessage = FString::Printf(TEXT("Class name '%s' is ambiguous; use one of: %s"), *ClassName, *FString::Join(Paths, TEXT(", ")));
+                return nullptr;
+            }
+        }
+    }
+
+    // Not native: a blueprint class, found through the blueprint index
+    FString BlueprintError;
+    if (UBlueprint* Blueprint = FUnrealMCPBlueprintIndex::Find(ClassName, nullptr, BlueprintError))
+    {
+        FUnrealMCPCompileQueue::EnsureCompiled(Blueprint);
+        if (Blueprint->GeneratedClass)
+        {
+            return CheckBase(Blueprint->GeneratedClass);
+        }
+    }
+
+    OutErrorMessage = FString::Printf(TEXT("Class not found: %s"), *ClassName);
+    return nullptr;
+}
+
+UFunction* FUnrealMCPFunctionIndex::FindFunction(const FString& FunctionName, const FString& ClassName, UClass* FallbackClass, FString& OutErrorMessage)
+{
+    EnsureBuilt();
+
+    // FName comparison ignores case, so these lookups are case-insensitive as before
+    const FName Name(*FunctionName, FNAME_Find);
+    const TArray<FFunctionEntry>* Entries = Name.IsNone() ? nullptr : FunctionsByName.Find(Name);
+
+    auto DescribeDeclaringClasses = [Entries]()
+    {
+        TArray<FString> ClassNames;
+        for (int32 Index = 0; Entries && Index < Entries->Num() && ClassNames.Num() < 10; ++Index)
+        {
+            if ((*Entries)[Index].Class.IsValid())
+            {
+                ClassNames.AddUnique((*Entries)[Index].Class->GetName());
+            }
+        }
+        return FString::Join(ClassNames, TEXT(", "));
+    };
+
+    if (!ClassName.IsEmpty())
+    {
+        UClass* Class = FindClass(ClassName, OutErrorMessage);
+        if (!Class)
+        {
+            return nullptr;
+        }
+
+        UFunction* Function = Name.IsNone() ? nullptr : Class->FindFunctionByName(Name);
+        if (!Function)
+        {
+            const FString Declaring = DescribeDeclaringClasses();
+            OutErrorMessage = Declaring.IsEmpty()
+                ? FString::Printf(TEXT("Function not found: %s in target %s"), *FunctionName, *ClassName)
+                : FString::Printf(TEXT("Function not found: %s in target %s (declared by: %s)"), *FunctionName, *ClassName, *Declaring);
+        }
+        return Function;
+    }
+
+    if (FallbackClass && !Name.IsNone())
+    {
+        if (UFunction* Function = FallbackClass->FindFunctionByName(Name))
+        {
+            return Function;
+        }
+    }
+
+    // Without a target, a member function of some other class has no object to be called on,
+    // so only static library functions remain
+    TArray<UFunction*> StaticCandidates;
+    for (int32 Index = 0; Entries && Index < Entries->Num(); ++Index)
+    {
+        UFunction* Function = (*Entries)[Index].Function.Get();
+        if (Function && Function->HasAnyFunctionFlags(FUNC_Static))
+        {
+            StaticCandidates.Add(Function);
+        }
+    }
+
+    if (StaticCandidates.Num() == 1)
+    {
+        return StaticCandidates[0];
+    }
+
+    const FString Declaring = DescribeDeclaringClasses();
+    if (StaticCandidates.Num() > 1)
+    {
+        OutErrorMessage = FString::Printf(TEXT("Function '%s' is declared by several classes; pass one as 'target': %s"), *FunctionName, *Declaring);
+    }
+    else if (!Declaring.IsEmpty())
+    {
+        OutErrorMessage = FString::Printf(TEXT("Function '%s' is not a static function or a member of the blueprint's class; pass the class that declares it as 'target': %s"), *FunctionName, *Declaring);
+    }
+    else
+    {
+        OutErrorMessage = FString::Printf(TEXT("Function not found: %s in target Blueprint"), *FunctionName);
+    }
+    return nullptr;
+}
+
+void FUnrealMCPFunctionIndex::EnsureBuilt()
+{
+    StartBuild();
+
+    if (PendingClasses.Num() > 0)
+    {
+        while (PendingClasses.Num() > 0)
+        {
+            IndexClass(PendingClasses.Pop(EAllowShrinking::No).Get());
+        }
+        UE_LOG(LogTemp, Display, TEXT("UnrealMCP: function index finished on demand (%d classes, %d function names)"), ClassesByName.Num(), FunctionsByName.Num());
+    }
+}
+
+void FUnrealMCPFunctionIndex::IndexClass(UClass* Class)
+{
+    if (!Class || !Class->HasAnyClassFlags(CLASS_Native) || Class->HasAnyClassFlags(CLASS_NewerVersionExists))
+    {
+        return;
+    }
+
+    TArray<TWeakObjectPtr<UClass>>& SameName = ClassesByName.FindOrAdd(Class->GetFName());
+    if (SameName.Contains(Class))
+    {
+        return;
+    }
+    SameName.Add(Class);
+
+    // Declared functions only; inherited ones are found through FindFunctionByName on the target
+    for (TFieldIterator<UFunction> It(Class, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+    {
+        UFunction* Function = *It;
+        if (Function->HasAnyFunctionFlags(FUNC_BlueprintCallable) && !Function->HasAnyFunctionFlags(FUNC_Delegate))
+        {
+            FunctionsByName.FindOrAdd(Function->GetFName()).Add({ Function, Class });
+        }
+    }
+}
+
+bool FUnrealMCPFunctionIndex::TickBuild(float DeltaTime)
+{
+    const double EndTime = FPlatformTime::Seconds() + FunctionIndexTickBudgetSeconds;
+    while (PendingClasses.Num() > 0 && FPlatformTime::Seconds() < EndTime)
+    {
+        IndexClass(PendingClasses.Pop(EAllowShrinking::No).Get());
+    }
+
+    if (PendingClasses.Num() > 0)
+    {
+        return true;
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("UnrealMCP: function index built (%d classes, %d function names)"), ClassesByName.Num(), FunctionsByName.Num());
+    BuildTickerHandle.Reset();
+    return false;
+}
+
+void FUnrealMCPFunctionIndex::AddModuleClasses(FName ModuleName)
+{
+    // Classes of a module loaded before the build started are collected by Rebuild
+    if (!bStarted)
+    {
+        return;
+    }
+
+    // A newly loaded module brings its classes under /Script/<Module>; only those need walking
+    UPackage* Package = FindPackage(nullptr, *(TEXT("/Script/") + ModuleName.ToString()));
+    if (!Package)
+    {
+        return;
+    }
+
+    TArray<UObject*> Objects;
+    GetObjectsWithPackage(Package, Objects, false);
+    for (UObject* Object : Objects)
+    {
+        if (UClass* Class = Cast<UClass>(Object))
+        {
+            PendingClasses.Add(Class);
+        }
+    }
+
+    if (PendingClasses.Num() > 0)
+    {
+        FUnrealMCPApiSearch::Invalidate();
+        if (!BuildTickerHandle.IsValid())
+        {
+            BuildTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FUnrealMCPFunctionIndex::TickBuild));
+        }
+    }
+}
+
+void FUnrealMCPFunctionIndex::Rebuild()
+{
+    ClassesByName.Reset();
+    FunctionsByName.Reset();
+    PendingClasses.Reset();
+    FUnrealMCPApiSearch::Invalidate();
+
+    // Collecting the class list is quick; walking each class's functions is what gets time-sliced
+    for (TObjectIterator<UClass> It; It; ++It)
+    {
+        if (It->HasAnyClassFlags(CLASS_Native))
+        {
+            PendingClasses.Add(*It);
+        }
+    }
+
+    if (!BuildTickerHandle.IsValid())
+    {
+        BuildTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FUnrealMCPFunctionIndex::TickBuild));
+    }
+}
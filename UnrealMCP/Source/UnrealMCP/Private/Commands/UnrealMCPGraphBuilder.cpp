@@ -0,0 +1,381 @@
+#include "Commands/UnrealMCPGraphBuilder.h"
+#include "Commands/UnrealMCPCommonUtils.h"
+#include "Commands/UnrealMCPCompileQueue.h"
+#include "Commands/UnrealMCPFunctionIndex.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EdGraph/EdGraphSchema.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_Event.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_VariableGet.h"
+#include "K2Node_VariableSet.h"
+#include "K2Node_InputAction.h"
+#include "K2Node_Self.h"
+
+static void AddBuildError(TArray<TSharedPtr<FJsonValue>>& Errors, const FString& KeyField, const TSharedPtr<FJsonValue>& Key, const FString& Message)
+{
+    TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+    ErrorObj->SetField(KeyField, Key);
+    ErrorObj->SetStringField(TEXT("error"), Message);
+    Errors.Add(MakeShared<FJsonValueObject>(ErrorObj));
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPGraphBuilder::Build(UBlueprint* Blueprint, UEdGraph* Graph, const TSharedPtr<FJsonObject>& Spec, int32& OutCreatedCount, int32& OutLinkedCount)
+{
+    OutCreatedCount = 0;
+    OutLinkedCount = 0;
+
+    TMap<FString, UEdGraphNode*> LocalNodes;
+    TMap<FString, const TSharedPtr<FJsonObject>*> PinDefaults;
+    TArray<FString> NodeOrder;
+    TSharedPtr<FJsonObject> NodeIdsObj = MakeShared<FJsonObject>();
+    TArray<TSharedPtr<FJsonValue>> NodeErrors;
+    TArray<TSharedPtr<FJsonValue>> LinkErrors;
+
+    // Nodes first, so links may refer to any node in the spec regardless of order
+    const TArray<TSharedPtr<FJsonValue>>* NodeSpecs = nullptr;
+    Spec->TryGetArrayField(TEXT("nodes"), NodeSpecs);
+    for (int32 Index = 0; NodeSpecs && Index < NodeSpecs->Num(); ++Index)
+    {
+        const TSharedPtr<FJsonObject>* NodeSpec = nullptr;
+        if (!(*NodeSpecs)[Index]->TryGetObject(NodeSpec))
+        {
+            AddBuildError(NodeErrors, TEXT("index"), MakeShared<FJsonValueNumber>(Index), TEXT("Node spec is not an object"));
+            continue;
+        }
+
+        FString LocalId;
+        if (!(*NodeSpec)->TryGetStringField(TEXT("id"), LocalId) || LocalId.IsEmpty())
+        {
+            AddBuildError(NodeErrors, TEXT("index"), MakeShared<FJsonValueNumber>(Index), TEXT("Missing 'id'"));
+            continue;
+        }
+        if (LocalNodes.Contains(LocalId))
+        {
+            AddBuildError(NodeErrors, TEXT("id"), MakeShared<FJsonValueString>(LocalId), TEXT("Duplicate node id"));
+            continue;
+        }
+
+        FString ErrorMessage;
+        UEdGraphNode* Node = CreateNode(Blueprint, Graph, *NodeSpec, ErrorMessage);
+        if (!Node)
+        {
+            AddBuildError(NodeErrors, TEXT("id"), MakeShared<FJsonValueString>(LocalId), ErrorMessage);
+            continue;
+        }
+
+        LocalNodes.Add(LocalId, Node);
+        NodeOrder.Add(LocalId);
+        NodeIdsObj->SetStringField(LocalId, Node->NodeGuid.ToString());
+        ++OutCreatedCount;
+
+        const TSharedPtr<FJsonObject>* Defaults = nullptr;
+        if ((*NodeSpec)->TryGetObjectField(TEXT("pin_defaults"), Defaults))
+        {
+            PinDefaults.Add(LocalId, Defaults);
+        }
+    }
+
+    auto ResolveNode = [&LocalNodes, Graph](const FString& Id) -> UEdGraphNode*
+    {
+        if (UEdGraphNode* const* Local = LocalNodes.Find(Id))
+        {
+            return *Local;
+        }
+        for (UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (Node && Node->NodeGuid.ToString() == Id)
+            {
+                return Node;
+            }
+        }
+        return nullptr;
+    };
+
+    const UEdGraphSchema* Schema = Graph->GetSchema();
+    const TArray<TSharedPtr<FJsonValue>>* LinkSpecs = nullptr;
+    Spec->TryGetArrayField(TEXT("links"), LinkSpecs);
+    for (int32 Index = 0; LinkSpecs && Index < LinkSpecs->Num(); ++Index)
+    {
+        const TSharedPtr<FJsonValue> Key = MakeShared<FJsonValueNumber>(Index);
+        const TSharedPtr<FJsonObject>* LinkSpec = nullptr;
+        FString SourceId, SourcePinName, TargetId, TargetPinName;
+        if (!(*LinkSpecs)[Index]->TryGetObject(LinkSpec) ||
+            !(*LinkSpec)->TryGetStringField(TEXT("source_node_id"), SourceId) ||
+            !(*LinkSpec)->TryGetStringField(TEXT("source_pin"), SourcePinName) ||
+            !(*LinkSpec)->TryGetStringField(TEXT("target_node_id"), TargetId) ||
+            !(*LinkSpec)->TryGetStringField(TEXT("target_pin"), TargetPinName))
+        {
+            AddBuildError(LinkErrors, TEXT("index"), Key, TEXT("Link needs 'source_node_id', 'source_pin', 'target_node_id' and 'target_pin'"));
+            continue;
+        }
+
+        UEdGraphNode* SourceNode = ResolveNode(SourceId);
+        UEdGraphNode* TargetNode = ResolveNode(TargetId);
+        if (!SourceNode || !TargetNode)
+        {
+            AddBuildError(LinkErrors, TEXT("index"), Key, FString::Printf(TEXT("Node not found: %s"), SourceNode ? *TargetId : *SourceId));
+            continue;
+        }
+
+        UEdGraphPin* SourcePin = FUnrealMCPCommonUtils::FindPin(SourceNode, SourcePinName, EGPD_Output);
+        UEdGraphPin* TargetPin = FUnrealMCPCommonUtils::FindPin(TargetNode, TargetPinName, EGPD_Input);
+        if (!SourcePin || !TargetPin)
+        {
+            AddBuildError(LinkErrors, TEXT("index"), Key, SourcePin
+                ? FString::Printf(TEXT("Input pin '%s' not found on %s"), *TargetPinName, *TargetId)
+                : FString::Printf(TEXT("Output pin '%s' not found on %s"), *SourcePinName, *SourceId));
+            continue;
+        }
+
+        // Go through the schema so incompatible types are refused with its reason and
+        // wildcard or conversion pins are handled the way the editor would
+        const FPinConnectionResponse Response = Schema->CanCreateConnection(SourcePin, TargetPin);
+        if (Response.Response == CONNECT_RESPONSE_DISALLOW)
+        {
+            AddBuildError(LinkErrors, TEXT("index"), Key, Response.Message.ToString());
+            continue;
+        }
+        if (!Schema->TryCreateConnection(SourcePin, TargetPin))
+        {
+            AddBuildError(LinkErrors, TEXT("index"), Key, TEXT("Failed to create connection"));
+            continue;
+        }
+        ++OutLinkedCount;
+    }
+
+    // Defaults last: links can still change the type of wildcard pins
+    for (const FString& LocalId : NodeOrder)
+    {
+        const TSharedPtr<FJsonObject>* const* Defaults = PinDefaults.Find(LocalId);
+        if (!Defaults)
+        {
+            continue;
+        }
+
+        UEdGraphNode* Node = LocalNodes[LocalId];
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Default : (**Defaults)->Values)
+        {
+            FString ErrorMessage;
+            UEdGraphPin* Pin = FUnrealMCPCommonUtils::FindPin(Node, Default.Key, EGPD_Input);
+            if (!Pin)
+            {
+                ErrorMessage = FString::Printf(TEXT("Input pin '%s' not found"), *Default.Key);
+            }
+            else if (SetPinDefault(Pin, Default.Value, ErrorMessage))
+            {
+                continue;
+            }
+            AddBuildError(NodeErrors, TEXT("id"), MakeShared<FJsonValueString>(LocalId), ErrorMessage);
+        }
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetObjectField(TEXT("nodes"), NodeIdsObj);
+    ResultObj->SetArrayField(TEXT("node_errors"), NodeErrors);
+    ResultObj->SetArrayField(TEXT("link_errors"), LinkErrors);
+    ResultObj->SetNumberField(TEXT("created_count"), OutCreatedCount);
+    ResultObj->SetNumberField(TEXT("linked_count"), OutLinkedCount);
+    return ResultObj;
+}
+
+UEdGraphNode* FUnrealMCPGraphBuilder::CreateNode(UBlueprint* Blueprint, UEdGraph* Graph, const TSharedPtr<FJsonObject>& NodeSpec, FString& OutErrorMessage)
+{
+    FString Type;
+    if (!NodeSpec->TryGetStringField(TEXT("type"), Type))
+    {
+        OutErrorMessage = TEXT("Missing 'type'");
+        return nullptr;
+    }
+
+    auto GetRequired = [&NodeSpec, &OutErrorMessage](const TCHAR* Field, FString& OutValue)
+    {
+        if (!NodeSpec->TryGetStringField(Field, OutValue))
+        {
+            OutErrorMessage = FString::Printf(TEXT("Missing '%s'"), Field);
+            return false;
+        }
+        return true;
+    };
+
+    FVector2D Position(0.0f, 0.0f);
+    if (NodeSpec->HasField(TEXT("node_position")))
+    {
+        Position = FUnrealMCPCommonUtils::GetVector2DFromJson(NodeSpec, TEXT("node_position"));
+    }
+
+    FString Name;
+    UEdGraphNode* Node = nullptr;
+    if (Type == TEXT("event"))
+    {
+        if (!GetRequired(TEXT("event_name"), Name))
+        {
+            return nullptr;
+        }
+        Node = FUnrealMCPCommonUtils::CreateEventNode(Graph, Name, Position);
+        OutErrorMessage = FString::Printf(TEXT("Event not found: %s"), *Name);
+    }
+    else if (Type == TEXT("function"))
+    {
+        if (!GetRequired(TEXT("function_name"), Name))
+        {
+            return nullptr;
+        }
+        FString Target;
+        NodeSpec->TryGetStringField(TEXT("target"), Target);
+
+        // Only a lookup without a target searches the blueprint's own class and needs its edits compiled
+        UClass* OwnClass = nullptr;
+        if (Target.IsEmpty())
+        {
+            FUnrealMCPCompileQueue::EnsureCompiled(Blueprint);
+            OwnClass = Blueprint->GeneratedClass;
+        }
+        UFunction* Function = FUnrealMCPFunctionIndex::FindFunction(Name, Target, OwnClass, OutErrorMessage);
+        if (!Function)
+        {
+            return nullptr;
+        }
+        Node = FUnrealMCPCommonUtils::CreateFunctionCallNode(Graph, Function, Position);
+        OutErrorMessage = FString::Printf(TEXT("Failed to create function node: %s"), *Name);
+    }
+    else if (Type == TEXT("variable_get") || Type == TEXT("variable_set"))
+    {
+        if (!GetRequired(TEXT("variable_name"), Name))
+        {
+            return nullptr;
+        }
+        Node = Type == TEXT("variable_get")
+            ? (UEdGraphNode*)FUnrealMCPCommonUtils::CreateVariableGetNode(Graph, Blueprint, Name, Position)
+            : (UEdGraphNode*)FUnrealMCPCommonUtils::CreateVariableSetNode(Graph, Blueprint, Name, Position);
+        OutErrorMessage = FString::Printf(TEXT("Variable not found: %s"), *Name);
+    }
+    else if (Type == TEXT("component"))
+    {
+        if (!GetRequired(TEXT("component_name"), Name))
+        {
+            return nullptr;
+        }
+
+        // Same shape as add_blueprint_get_self_component_reference
+        UK2Node_VariableGet* ComponentNode = NewObject<UK2Node_VariableGet>(Graph);
+        ComponentNode->VariableReference.SetSelfMember(FName(*Name));
+        ComponentNode->NodePosX = Position.X;
+        ComponentNode->NodePosY = Position.Y;
+        Graph->AddNode(ComponentNode, true);
+        ComponentNode->CreateNewGuid();
+        ComponentNode->PostPlacedNewNode();
+        ComponentNode->AllocateDefaultPins();
+        ComponentNode->ReconstructNode();
+        Node = ComponentNode;
+    }
+    else if (Type == TEXT("input_action"))
+    {
+        if (!GetRequired(TEXT("action_name"), Name))
+        {
+            return nullptr;
+        }
+        Node = FUnrealMCPCommonUtils::CreateInputActionNode(Graph, Name, Position);
+        OutErrorMessage = TEXT("Failed to create input action node");
+    }
+    else if (Type == TEXT("self"))
+    {
+        Node = FUnrealMCPCommonUtils::CreateSelfReferenceNode(Graph, Position);
+        OutErrorMessage = TEXT("Failed to create self node");
+    }
+    else
+    {
+        OutErrorMessage = FString::Printf(TEXT("Unknown node type: %s (expected event, function, variable_get, variable_set, component, input_action or self)"), *Type);
+        return nullptr;
+    }
+
+    if (Node)
+    {
+        OutErrorMessage.Reset();
+    }
+    return Node;
+}
+
+bool FUnrealMCPGraphBuilder::SetPinDefault(UEdGraphPin* Pin, const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage)
+{
+    const UEdGraphSchema* Schema = Pin->GetSchema();
+    const FName Category = Pin->PinType.PinCategory;
+
+    if (Category == UEdGraphSchema_K2::PC_Object || Category == UEdGraphSchema_K2::PC_Class || Category == UEdGraphSchema_K2::PC_Interface)
+    {
+        FString Path;
+        if (!Value->TryGetString(Path))
+        {
+            OutErrorMessage = FString::Printf(TEXT("Pin '%s' takes an object path"), *Pin->PinName.ToString());
+            return false;
+        }
+
+        UObject* Object = nullptr;
+        if (Category == UEdGraphSchema_K2::PC_Class && !Path.IsEmpty())
+        {
+            Object = FUnrealMCPFunctionIndex::FindClass(Path, OutErrorMessage, Cast<UClass>(Pin->PinType.PinSubCategoryObject.Get()));
+        }
+        else if (!Path.IsEmpty())
+        {
+            Object = LoadObject<UObject>(nullptr, *Path);
+        }
+        if (!Object && !Path.IsEmpty())
+        {
+            const FString Reason = OutErrorMessage.IsEmpty() ? FString() : FString::Printf(TEXT(" (%s)"), *OutErrorMessage);
+            OutErrorMessage = FString::Printf(TEXT("Object not found for pin '%s': %s%s"), *Pin->PinName.ToString(), *Path, *Reason);
+            return false;
+        }
+
+        OutErrorMessage = Schema->IsPinDefaultValid(Pin, FString(), Object, FText::GetEmpty());
+        if (!OutErrorMessage.IsEmpty())
+        {
+            return false;
+        }
+        Schema->TrySetDefaultObject(*Pin, Object);
+        return true;
+    }
+
+    // Everything else goes in as the pin's default value string; vectors and rotators take "X,Y,Z"
+    FString DefaultString;
+    switch (Value->Type)
+    {
+    case EJson::String:
+        DefaultString = Value->AsString();
+        break;
+    case EJson::Number:
+        DefaultString = (Category == UEdGraphSchema_K2::PC_Int || Category == UEdGraphSchema_K2::PC_Int64 || Category == UEdGraphSchema_K2::PC_Byte)
+            ? LexToString((int64)FMath::RoundToDouble(Value->AsNumber()))
+            : FString::SanitizeFloat(Value->AsNumber());
+        break;
+    case EJson::Boolean:
+        DefaultString = Value->AsBool() ? TEXT("true") : TEXT("false");
+        break;
+    case EJson::Array:
+        for (const TSharedPtr<FJsonValue>& Component : Value->AsArray())
+        {
+            DefaultString += (DefaultString.IsEmpty() ? TEXT("") : TEXT(",")) + FString::SanitizeFloat(Component->AsNumber());
+        }
+        break;
+    default:
+        OutErrorMessage = FString::Printf(TEXT("Unsupported default value for pin '%s'"), *Pin->PinName.ToString());
+        return false;
+    }
+
+    if (Category == UEdGraphSchema_K2::PC_Text)
+    {
+        Schema->TrySetDefaultText(*Pin, FText::FromString(DefaultString));
+        return true;
+    }
+
+    OutErrorMessage = Schema->IsPinDefaultValid(Pin, DefaultString, nullptr, FText::GetEmpty());
+    if (!OutErrorMessage.IsEmpty())
+    {
+        OutErrorMessage = FString::Printf(TEXT("Pin '%s': %s"), *Pin->PinName.ToString(), *OutErrorMessage);
+        return false;
+    }
+    Schema->TrySetDefaultValue(*Pin, DefaultString);
+    return true;
+}
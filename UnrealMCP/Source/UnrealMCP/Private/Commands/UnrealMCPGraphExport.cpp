@@ -0,0 +1,416 @@
+#include "Commands/UnrealMCPGraphExport.h"
+#include "Commands/UnrealMCPBlueprintHash.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+
+TMap<FString, FUnrealMCPGraphExport::FBlueprintState> FUnrealMCPGraphExport::States;
+TMap<FObjectKey, FUnrealMCPGraphExport::FGraphHashes> FUnrealMCPGraphExport::GraphHashes;
+uint64 FUnrealMCPGraphExport::NextRevision = 0;
+
+// How many past exports per blueprint a since_revision can still be diffed against
+static constexpr int32 MaxGraphSnapshots = 4;
+
+// Strings written once per response and referenced by index. Pin names and defaults are
+// case sensitive, so the lookup cannot use FString's default case-insensitive hashing.
+struct FUnrealMCPGraphStringTable
+{
+    struct FKeyFuncs : BaseKeyFuncs<TPair<FString, int32>, FString, false>
+    {
+        static const FString& GetSetKey(const TPair<FString, int32>& Element) { return Element.Key; }
+        static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+        static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+    };
+
+    int32 Add(const FString& Value)
+    {
+        if (const int32* Existing = Indices.Find(Value))
+        {
+            return *Existing;
+        }
+        const int32 Index = Strings.Add(Value);
+        Indices.Add(Value, Index);
+        return Index;
+    }
+
+    TArray<TSharedPtr<FJsonValue>> ToJson() const
+    {
+        TArray<TSharedPtr<FJsonValue>> Values;
+        Values.Reserve(Strings.Num());
+        for (const FString& Value : Strings)
+        {
+            Values.Add(MakeShared<FJsonValueString>(Value));
+        }
+        return Values;
+    }
+
+    TMap<FString, int32, FDefaultSetAllocator, FKeyFuncs> Indices;
+    TArray<FString> Strings;
+};
+
+static TSharedPtr<FJsonValue> MakeIntArray(std::initializer_list<int32> Values)
+{
+    TArray<TSharedPtr<FJsonValue>> Array;
+    for (const int32 Value : Values)
+    {
+        Array.Add(MakeShared<FJsonValueNumber>(Value));
+    }
+    return MakeShared<FJsonValueArray>(Array);
+}
+
+static TSharedPtr<FJsonValue> MakeStringArray(std::initializer_list<const TCHAR*> Values)
+{
+    TArray<TSharedPtr<FJsonValue>> Array;
+    for (const TCHAR* Value : Values)
+    {
+        Array.Add(MakeShared<FJsonValueString>(Value));
+    }
+    return MakeShared<FJsonValueArray>(Array);
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPGraphExport::Export(UBlueprint* Blueprint, const FString& GraphName, const FString& SinceRevision)
+{
+    if (NextRevision == 0)
+    {
+        // Start from the clock so tokens left over from an earlier editor session do not match this one's
+        NextRevision = (uint64)FDateTime::UtcNow().GetTicks();
+    }
+
+    TArray<UEdGraph*> AllGraphs;
+    Blueprint->GetAllGraphs(AllGraphs);
+
+    TArray<UEdGraph*> Graphs;
+    for (UEdGraph* Graph : AllGraphs)
+    {
+        if (Graph && (GraphName.IsEmpty() || Graph->GetName() == GraphName))
+        {
+            Graphs.Add(Graph);
+        }
+    }
+
+    FBlueprintState& State = States.FindOrAdd(Blueprint->GetPathName() + TEXT("|") + GraphName);
+
+    // First pass: ids, hashes and visible pin indices for everything in scope
+    FSnapshot Current;
+    TMap<const UEdGraphNode*, int32> NodeIds;
+    TMap<const UEdGraphPin*, int32> PinIndices;
+    for (const UEdGraph* Graph : Graphs)
+    {
+        // Hashing exports every node's properties, so reuse the hashes of a graph nobody has modified
+        FGraphHashes& Hashes = GraphHashes.FindOrAdd(FObjectKey(Graph));
+        Hashes.Blueprint = FObjectKey(Blueprint);
+
+        for (const UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (!Node)
+            {
+                continue;
+            }
+
+            const int32 NodeId = GetId(State, Node->NodeGuid);
+            NodeIds.Add(Node, NodeId);
+
+            uint64* Hash = Hashes.NodeHashes.Find(FObjectKey(Node));
+            if (!Hash)
+            {
+                // The structural hash leaves layout out, so fold the position back in
+                const uint64 Position = ((uint64)(uint32)Node->NodePosX << 32) | (uint32)Node->NodePosY;
+                Hash = &Hashes.NodeHashes.Add(FObjectKey(Node), FUnrealMCPBlueprintHash::ComputeNode(Node) ^ (Position * 0x9E3779B97F4A7C15ull));
+            }
+            Current.NodeHashes.Add(NodeId, *Hash);
+
+            int32 PinIndex = 0;
+            for (const UEdGraphPin* Pin : Node->Pins)
+            {
+                if (Pin && !Pin->bHidden)
+                {
+                    PinIndices.Add(Pin, PinIndex++);
+                }
+            }
+        }
+    }
+
+    // Links run from an output pin to an input pin, so each one is recorded once
+    for (const TPair<const UEdGraphNode*, int32>& NodeEntry : NodeIds)
+    {
+        for (const UEdGraphPin* Pin : NodeEntry.Key->Pins)
+        {
+            const int32* FromPin = PinIndices.Find(Pin);
+            if (!FromPin || Pin->Direction != EGPD_Output)
+            {
+                continue;
+            }
+
+            for (const UEdGraphPin* Linked : Pin->LinkedTo)
+            {
+                const int32* ToPin = PinIndices.Find(Linked);
+                const int32* ToNode = ToPin ? NodeIds.Find(Linked->GetOwningNodeUnchecked()) : nullptr;
+                if (ToNode)
+                {
+                    Current.Links.Add(FIntVector4(NodeEntry.Value, *FromPin, *ToNode, *ToPin));
+                }
+            }
+        }
+    }
+
+    // An export identical to the latest one keeps its revision, so polling an untouched
+    // blueprint neither burns revisions nor pushes older snapshots out
+    const FSnapshot* Latest = State.Snapshots.Num() > 0 ? &State.Snapshots.Last() : nullptr;
+    if (Latest && Latest->NodeHashes.OrderIndependentCompareEqual(Current.NodeHashes) && Latest->Links.Num() == Current.Links.Num() && Latest->Links.Includes(Current.Links))
+    {
+        Current.Revision = Latest->Revision;
+    }
+    else
+    {
+        Current.Revision = NextRevision++;
+        State.Snapshots.Add(Current);
+        if (State.Snapshots.Num() > MaxGraphSnapshots)
+        {
+            State.Snapshots.RemoveAt(0);
+        }
+    }
+
+    const FSnapshot* Base = nullptr;
+    if (!SinceRevision.IsEmpty())
+    {
+        const uint64 Since = FCString::Strtoui64(*SinceRevision, nullptr, 10);
+        Base = State.Snapshots.FindByPredicate([Since](const FSnapshot& Snapshot) { return Snapshot.Revision == Since; });
+    }
+
+    FUnrealMCPGraphStringTable Strings;
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+
+    TArray<TSharedPtr<FJsonValue>> GraphsJson;
+    for (const UEdGraph* Graph : Graphs)
+    {
+        TArray<TSharedPtr<FJsonValue>> GraphJson;
+        GraphJson.Add(MakeShared<FJsonValueNumber>(GetId(State, Graph->GraphGuid)));
+        GraphJson.Add(MakeShared<FJsonValueString>(Graph->GetName()));
+        GraphJson.Add(MakeShared<FJsonValueString>(DescribeGraphType(Blueprint, Graph)));
+        GraphsJson.Add(MakeShared<FJsonValueArray>(GraphJson));
+    }
+
+    TArray<TSharedPtr<FJsonValue>> NodesJson;
+    for (const UEdGraph* Graph : Graphs)
+    {
+        const int32 GraphId = GetId(State, Graph->GraphGuid);
+        for (const UEdGraphNode* Node : Graph->Nodes)
+        {
+            const int32* NodeId = NodeIds.Find(Node);
+            if (!NodeId)
+            {
+                continue;
+            }
+
+            if (Base)
+            {
+                const uint64* BaseHash = Base->NodeHashes.Find(*NodeId);
+                if (BaseHash && *BaseHash == Current.NodeHashes[*NodeId])
+                {
+                    continue;
+                }
+            }
+
+            TArray<TSharedPtr<FJsonValue>> PinsJson;
+            for (const UEdGraphPin* Pin : Node->Pins)
+            {
+                if (!Pin || Pin->bHidden)
+                {
+                    continue;
+                }
+
+                FString Default = Pin->DefaultObject ? Pin->DefaultObject->GetPathName() : Pin->DefaultValue;
+                if (Default.IsEmpty() && !Pin->DefaultTextValue.IsEmpty())
+                {
+                    Default = Pin->DefaultTextValue.ToString();
+                }
+
+                PinsJson.Add(MakeIntArray({
+                    Strings.Add(Pin->PinName.ToString()),
+                    Pin->Direction == EGPD_Output ? 1 : 0,
+                    Strings.Add(DescribePinType(Pin->PinType)),
+                    Default.IsEmpty() ? -1 : Strings.Add(Default) }));
+            }
+
+            TArray<TSharedPtr<FJsonValue>> NodeJson;
+            NodeJson.Add(MakeShared<FJsonValueNumber>(*NodeId));
+            NodeJson.Add(MakeShared<FJsonValueNumber>(GraphId));
+            NodeJson.Add(MakeShared<FJsonValueNumber>(Strings.Add(Node->GetClass()->GetName())));
+            NodeJson.Add(MakeShared<FJsonValueNumber>(Strings.Add(Node->GetNodeTitle(ENodeTitleType::ListView).ToString())));
+            NodeJson.Add(MakeShared<FJsonValueNumber>(Node->NodePosX));
+            NodeJson.Add(MakeShared<FJsonValueNumber>(Node->NodePosY));
+            NodeJson.Add(MakeShared<FJsonValueString>(Node->NodeGuid.ToString()));
+            NodeJson.Add(MakeShared<FJsonValueArray>(PinsJson));
+            NodesJson.Add(MakeShared<FJsonValueArray>(NodeJson));
+        }
+    }
+
+    auto LinkToJson = [](const FIntVector4& Link)
+    {
+        return MakeIntArray({ Link.X, Link.Y, Link.Z, Link.W });
+    };
+
+    TArray<TSharedPtr<FJsonValue>> LinksJson;
+    for (const FIntVector4& Link : Current.Links)
+    {
+        if (!Base || !Base->Links.Contains(Link))
+        {
+            LinksJson.Add(LinkToJson(Link));
+        }
+    }
+
+    ResultObj->SetStringField(TEXT("revision"), FString::Printf(TEXT("%llu"), Current.Revision));
+    ResultObj->SetBoolField(TEXT("full"), Base == nullptr);
+    ResultObj->SetArrayField(TEXT("graphs"), GraphsJson);
+    ResultObj->SetArrayField(Base ? TEXT("nodes_changed") : TEXT("nodes"), NodesJson);
+    ResultObj->SetArrayField(Base ? TEXT("links_added") : TEXT("links"), LinksJson);
+
+    if (Base)
+    {
+        ResultObj->SetStringField(TEXT("since_revision"), SinceRevision);
+
+        TArray<TSharedPtr<FJsonValue>> RemovedNodesJson;
+        for (const TPair<int32, uint64>& Entry : Base->NodeHashes)
+        {
+            if (!Current.NodeHashes.Contains(Entry.Key))
+            {
+                RemovedNodesJson.Add(MakeShared<FJsonValueNumber>(Entry.Key));
+            }
+        }
+        ResultObj->SetArrayField(TEXT("nodes_removed"), RemovedNodesJson);
+
+        TArray<TSharedPtr<FJsonValue>> RemovedLinksJson;
+        for (const FIntVector4& Link : Base->Links)
+        {
+            if (!Current.Links.Contains(Link))
+            {
+                RemovedLinksJson.Add(LinkToJson(Link));
+            }
+        }
+        ResultObj->SetArrayField(TEXT("links_removed"), RemovedLinksJson);
+    }
+    else
+    {
+        // Field order of the positional records, so callers need not hard-code it
+        TSharedPtr<FJsonObject> LayoutObj = MakeShared<FJsonObject>();
+        LayoutObj->SetField(TEXT("graph"), MakeStringArray({ TEXT("id"), TEXT("name"), TEXT("type") }));
+        LayoutObj->SetField(TEXT("node"), MakeStringArray({ TEXT("id"), TEXT("graph"), TEXT("class"), TEXT("title"), TEXT("x"), TEXT("y"), TEXT("guid"), TEXT("pins") }));
+        LayoutObj->SetField(TEXT("pin"), MakeStringArray({ TEXT("name"), TEXT("direction"), TEXT("type"), TEXT("default") }));
+        LayoutObj->SetField(TEXT("link"), MakeStringArray({ TEXT("from_node"), TEXT("from_pin"), TEXT("to_node"), TEXT("to_pin") }));
+        ResultObj->SetObjectField(TEXT("layout"), LayoutObj);
+    }
+
+    ResultObj->SetArrayField(TEXT("strings"), Strings.ToJson());
+    return ResultObj;
+}
+
+void FUnrealMCPGraphExport::OnObjectChanged(UObject* Object)
+{
+    if (GraphHashes.Num() == 0 || !Object)
+    {
+        return;
+    }
+
+    if (const UEdGraphNode* Node = Cast<UEdGraphNode>(Object))
+    {
+        GraphHashes.Remove(FObjectKey(Node->GetGraph()));
+    }
+    else if (const UEdGraph* Graph = Cast<UEdGraph>(Object))
+    {
+        GraphHashes.Remove(FObjectKey(Graph));
+    }
+    else if (Object->IsA<UBlueprint>())
+    {
+        // Blueprint level edits (variables, interfaces, MarkBlueprintAsModified) can change any node
+        const FObjectKey BlueprintKey(Object);
+        for (auto It = GraphHashes.CreateIterator(); It; ++It)
+        {
+            if (It.Value().Blueprint == BlueprintKey)
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+}
+
+void FUnrealMCPGraphExport::ClearCache()
+{
+    GraphHashes.Reset();
+}
+
+int32 FUnrealMCPGraphExport::GetId(FBlueprintState& State, const FGuid& Guid)
+{
+    if (const int32* Existing = State.Ids.Find(Guid))
+    {
+        return *Existing;
+    }
+    const int32 Id = State.NextId++;
+    State.Ids.Add(Guid, Id);
+    return Id;
+}
+
+FString FUnrealMCPGraphExport::DescribePinType(const FEdGraphPinType& PinType)
+{
+    auto Terminal = [](const FName& Category, const FName& SubCategory, const TWeakObjectPtr<UObject>& SubCategoryObject)
+    {
+        if (SubCategoryObject.IsValid())
+        {
+            return FString::Printf(TEXT("%s:%s"), *Category.ToString(), *SubCategoryObject->GetName());
+        }
+        if (!SubCategory.IsNone())
+        {
+            return FString::Printf(TEXT("%s:%s"), *Category.ToString(), *SubCategory.ToString());
+        }
+        return Category.ToString();
+    };
+
+    FString Description = Terminal(PinType.PinCategory, PinType.PinSubCategory, PinType.PinSubCategoryObject);
+    switch (PinType.ContainerType)
+    {
+    case EPinContainerType::Array:
+        Description = FString::Printf(TEXT("array<%s>"), *Description);
+        break;
+    case EPinContainerType::Set:
+        Description = FString::Printf(TEXT("set<%s>"), *Description);
+        break;
+    case EPinContainerType::Map:
+        Description = FString::Printf(TEXT("map<%s,%s>"), *Description, *Terminal(
+            PinType.PinValueType.TerminalCategory, PinType.PinValueType.TerminalSubCategory, PinType.PinValueType.TerminalSubCategoryObject));
+        break;
+    default:
+        break;
+    }
+
+    if (PinType.bIsConst)
+    {
+        Description = TEXT("const ") + Description;
+    }
+    if (PinType.bIsReference)
+    {
+        Description += TEXT("&");
+    }
+    return Description;
+}
+
+const TCHAR* FUnrealMCPGraphExport::DescribeGraphType(const UBlueprint* Blueprint, const UEdGraph* Graph)
+{
+    UEdGraph* MutableGraph = const_cast<UEdGraph*>(Graph);
+    if (Blueprint->UbergraphPages.Contains(MutableGraph))
+    {
+        return TEXT("event");
+    }
+    if (Blueprint->FunctionGraphs.Contains(MutableGraph))
+    {
+        return TEXT("function");
+    }
+    if (Blueprint->MacroGraphs.Contains(MutableGraph))
+    {
+        return TEXT("macro");
+    }
+    if (Blueprint->DelegateSignatureGraphs.Contains(MutableGraph))
+    {
+        return TEXT("delegate");
+    }
+    return Graph->GetOuter() && Graph->GetOuter()->IsA<UEdGraphNode>() ? TEXT("subgraph") : TEXT("other");
+}
@@ -0,0 +1,1034 @@
+#include "Commands/UnrealMCPInstanceCommands.h"
+#include "Commands/UnrealMCPCommonUtils.h"
+#include "UnrealMCPJsonDocument.h"
+#include "UnrealMCPJsonWriter.h"
+#include "Editor.h"
+#include "EditorAssetLibrary.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "Engine/StaticMesh.h"
+#include "Materials/MaterialInterface.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Components/SplineComponent.h"
+#include "LandscapeProxy.h"
+#include "Async/ParallelFor.h"
+#include "Math/RandomStream.h"
+#include "Algo/Unique.h"
+
+FUnrealMCPInstanceCommands::FUnrealMCPInstanceCommands()
+{
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPInstanceCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    if (CommandType == TEXT("get_mesh_instances"))
+    {
+        return HandleGetMeshInstances(Params);
+    }
+    else if (CommandType == TEXT("update_mesh_instances"))
+    {
+        return HandleUpdateMeshInstances(Params);
+    }
+    else if (CommandType == TEXT("remove_mesh_instances"))
+    {
+        return HandleRemoveMeshInstances(Params);
+    }
+    else if (CommandType == TEXT("scatter_instances"))
+    {
+        return HandleScatterInstances(Params);
+    }
+
+    return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown instance command: %s"), *CommandType));
+}
+
+bool FUnrealMCPInstanceCommands::IsStreamingCommand(const FString& CommandType)
+{
+    return CommandType == TEXT("get_mesh_instances");
+}
+
+bool FUnrealMCPInstanceCommands::StreamCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, FUnrealMCPJsonWriter& Writer, FString& OutErrorMessage)
+{
+    if (CommandType == TEXT("get_mesh_instances"))
+    {
+        return StreamGetMeshInstances(Params, Writer, OutErrorMessage);
+    }
+
+    OutErrorMessage = FString::Printf(TEXT("Command does not support streaming: %s"), *CommandType);
+    return false;
+}
+
+bool FUnrealMCPInstanceCommands::IsViewCommand(const FString& CommandType)
+{
+    return CommandType == TEXT("add_mesh_instances");
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPInstanceCommands::HandleViewCommand(const FString& CommandType, const FUnrealMCPJsonView& Params)
+{
+    if (CommandType == TEXT("add_mesh_instances"))
+    {
+        return HandleAddMeshInstances(Params);
+    }
+
+    return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown instance command: %s"), *CommandType));
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPInstanceCommands::HandleAddMeshInstances(const FUnrealMCPJsonView& Params)
+{
+    // Get required parameters
+    FString MeshPath;
+    if (!Params.TryGetStringField(TEXT("mesh"), MeshPath))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'mesh' parameter"));
+    }
+
+    FString HostActorName;
+    if (!Params.TryGetStringField(TEXT("actor_name"), HostActorName))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'actor_name' parameter"));
+    }
+
+    // Get optional parameters
+    FString MaterialPath;
+    Params.TryGetStringField(TEXT("material"), MaterialPath);
+
+    FString ComponentName;
+    Params.TryGetStringField(TEXT("component_name"), ComponentName);
+
+    bool bWorldSpace = true;
+    Params.TryGetBoolField(TEXT("world_space"), bWorldSpace);
+
+    UStaticMesh* Mesh = Cast<UStaticMesh>(UEditorAssetLibrary::LoadAsset(MeshPath));
+    if (!Mesh)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to load mesh: %s"), *MeshPath));
+    }
+
+    UMaterialInterface* Material = nullptr;
+    if (!MaterialPath.IsEmpty())
+    {
+        Material = Cast<UMaterialInterface>(UEditorAssetLibrary::LoadAsset(MaterialPath));
+        if (!Material)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to load material: %s"), *MaterialPath));
+        }
+    }
+
+    TArray<FTransform> Transforms;
+    FString ErrorMessage;
+    if (!GetTransformsFromJson(Params, Transforms, ErrorMessage))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+    }
+
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
+    UHierarchicalInstancedStaticMeshComponent* Component = FindOrCreateInstancedComponent(World, HostActorName, ComponentName, Mesh, Material, ErrorMessage);
+    if (!Component)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+    }
+
+    // Add all instances in one call so the cluster tree is rebuilt once
+    Component->Modify();
+    const TArray<int32> NewIndices = Component->AddInstances(Transforms, true, bWorldSpace);
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("actor_name"), Component->GetOwner()->GetName());
+    ResultObj->SetStringField(TEXT("component_name"), Component->GetName());
+    ResultObj->SetNumberField(TEXT("added"), NewIndices.Num());
+    ResultObj->SetNumberField(TEXT("first_index"), NewIndices.Num() > 0 ? NewIndices[0] : INDEX_NONE);
+    ResultObj->SetNumberField(TEXT("instance_count"), Component->GetInstanceCount());
+    return ResultObj;
+}
+
+bool FUnrealMCPInstanceCommands::SelectMeshInstances(const TSharedPtr<FJsonObject>& Params, FMeshInstanceSelection& OutSelection, FString& OutErrorMessage)
+{
+    UHierarchicalInstancedStaticMeshComponent* Component = FindInstancedComponent(Params, OutErrorMessage);
+    if (!Component)
+    {
+        return false;
+    }
+
+    bool bWorldSpace = true;
+    Params->TryGetBoolField(TEXT("world_space"), bWorldSpace);
+    Params->TryGetBoolField(TEXT("binary"), OutSelection.bBinary);
+
+    // Select instances: explicit indices, or a [start_index, start_index + count) range
+    const int32 InstanceCount = Component->GetInstanceCount();
+    TArray<int32>& Indices = OutSelection.Indices;
+    FUnrealMCPCommonUtils::GetIntArrayFromJson(Params, TEXT("indices"), Indices);
+    if (Indices.Num() == 0)
+    {
+        int32 StartIndex = 0;
+        int32 Count = InstanceCount;
+        Params->TryGetNumberField(TEXT("start_index"), StartIndex);
+        Params->TryGetNumberField(TEXT("count"), Count);
+
+        StartIndex = FMath::Clamp(StartIndex, 0, InstanceCount);
+        Count = FMath::Clamp(Count, 0, InstanceCount - StartIndex);
+        Indices.Reserve(Count);
+        for (int32 Index = StartIndex; Index < StartIndex + Count; ++Index)
+        {
+            Indices.Add(Index);
+        }
+    }
+
+    OutSelection.Locations.Reserve(Indices.Num() * 3);
+    OutSelection.Rotations.Reserve(Indices.Num() * 3);
+    OutSelection.Scales.Reserve(Indices.Num() * 3);
+    for (int32 Index : Indices)
+    {
+        FTransform InstanceTransform;
+        if (!Component->GetInstanceTransform(Index, InstanceTransform, bWorldSpace))
+        {
+            OutErrorMessage = FString::Printf(TEXT("Invalid instance index: %d"), Index);
+            return false;
+        }
+
+        const FVector Location = InstanceTransform.GetLocation();
+        const FRotator Rotation = InstanceTransform.Rotator();
+        const FVector Scale = InstanceTransform.GetScale3D();
+        OutSelection.Locations.Append({ (float)Location.X, (float)Location.Y, (float)Location.Z });
+        OutSelection.Rotations.Append({ (float)Rotation.Pitch, (float)Rotation.Yaw, (float)Rotation.Roll });
+        OutSelection.Scales.Append({ (float)Scale.X, (float)Scale.Y, (float)Scale.Z });
+    }
+
+    OutSelection.Component = Component;
+    OutSelection.InstanceCount = InstanceCount;
+    return true;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPInstanceCommands::HandleGetMeshInstances(const TSharedPtr<FJsonObject>& Params)
+{
+    FMeshInstanceSelection Selection;
+    FString ErrorMessage;
+    if (!SelectMeshInstances(Params, Selection, ErrorMessage))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+    }
+
+    TArray<TSharedPtr<FJsonValue>> IndexArray;
+    IndexArray.Reserve(Selection.Indices.Num());
+    for (int32 Index : Selection.Indices)
+    {
+        IndexArray.Add(MakeShared<FJsonValueNumber>(Index));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("component_name"), Selection.Component->GetName());
+    ResultObj->SetNumberField(TEXT("instance_count"), Selection.InstanceCount);
+    ResultObj->SetArrayField(TEXT("indices"), IndexArray);
+    ResultObj->SetField(TEXT("locations"), FUnrealMCPCommonUtils::PackedFloatArrayToJson(Selection.Locations, Selection.bBinary));
+    ResultObj->SetField(TEXT("rotations"), FUnrealMCPCommonUtils::PackedFloatArrayToJson(Selection.Rotations, Selection.bBinary));
+    ResultObj->SetField(TEXT("scales"), FUnrealMCPCommonUtils::PackedFloatArrayToJson(Selection.Scales, Selection.bBinary));
+    return ResultObj;
+}
+
+bool FUnrealMCPInstanceCommands::StreamGetMeshInstances(const TSharedPtr<FJsonObject>& Params, FUnrealMCPJsonWriter& Writer, FString& OutErrorMessage)
+{
+    FMeshInstanceSelection Selection;
+    if (!SelectMeshInstances(Params, Selection, OutErrorMessage))
+    {
+        return false;
+    }
+
+    Writer.BeginObject();
+    Writer.WriteStringField(TEXT("component_name"), Selection.Component->GetName());
+    Writer.WriteKey(TEXT("instance_count"));
+    Writer.WriteInt(Selection.InstanceCount);
+    Writer.WriteKey(TEXT("indices"));
+    Writer.BeginArray();
+    for (int32 Index : Selection.Indices)
+    {
+        Writer.WriteInt(Index);
+    }
+    Writer.EndArray();
+    Writer.WriteKey(TEXT("locations"));
+    Writer.WriteFloatArray(Selection.Locations, Selection.bBinary);
+    Writer.WriteKey(TEXT("rotations"));
+    Writer.WriteFloatArray(Selection.Rotations, Selection.bBinary);
+    Writer.WriteKey(TEXT("scales"));
+    Writer.WriteFloatArray(Selection.Scales, Selection.bBinary);
+    Writer.EndObject();
+    return true;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPInstanceCommands::HandleUpdateMeshInstances(const TSharedPtr<FJsonObject>& Params)
+{
+    FString ErrorMessage;
+    UHierarchicalInstancedStaticMeshComponent* Component = FindInstancedComponent(Params, ErrorMessage);
+    if (!Component)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+    }
+
+    bool bWorldSpace = true;
+    Params->TryGetBoolField(TEXT("world_space"), bWorldSpace);
+
+    TArray<FVector> Locations;
+    TArray<FVector> Rotations;
+    TArray<FVector> Scales;
+    if (!FUnrealMCPCommonUtils::GetPackedVectorArrayFromJson(Params, TEXT("locations"), Locations, ErrorMessage) ||
+        !FUnrealMCPCommonUtils::GetPackedVectorArrayFromJson(Params, TEXT("rotations"), Rotations, ErrorMessage) ||
+        !FUnrealMCPCommonUtils::GetPackedVectorArrayFromJson(Params, TEXT("scales"), Scales, ErrorMessage))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+    }
+
+    const int32 Count = FMath::Max3(Locations.Num(), Rotations.Num(), Scales.Num());
+    if ((Locations.Num() > 0 && Locations.Num() != Count) ||
+        (Rotations.Num() > 0 && Rotations.Num() != Count) ||
+        (Scales.Num() > 0 && Scales.Num() != Count))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(
+            TEXT("Array length mismatch: %d locations, %d rotations, %d scales"), Locations.Num(), Rotations.Num(), Scales.Num()));
+    }
+
+    // Target instances: explicit indices, or a contiguous run from start_index
+    TArray<int32> Indices;
+    FUnrealMCPCommonUtils::GetIntArrayFromJson(Params, TEXT("indices"), Indices);
+    const bool bContiguous = Indices.Num() == 0;
+    if (bContiguous)
+    {
+        int32 StartIndex = 0;
+        Params->TryGetNumberField(TEXT("start_index"), StartIndex);
+        for (int32 Offset = 0; Offset < Count; ++Offset)
+        {
+            Indices.Add(StartIndex + Offset);
+        }
+    }
+    else if (Indices.Num() != Count)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(
+            TEXT("Got %d indices but %d transforms"), Indices.Num(), Count));
+    }
+
+    // Merge the provided columns over the current instance transforms
+    TArray<FTransform> NewTransforms;
+    NewTransforms.SetNum(Count);
+    for (int32 Offset = 0; Offset < Count; ++Offset)
+    {
+        FTransform& InstanceTransform = NewTransforms[Offset];
+        if (!Component->GetInstanceTransform(Indices[Offset], InstanceTransform, bWorldSpace))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Invalid instance index: %d"), Indices[Offset]));
+        }
+        if (Locations.Num() > 0)
+        {
+            InstanceTransform.SetLocation(Locations[Offset]);
+        }
+        if (Rotations.Num() > 0)
+        {
+            InstanceTransform.SetRotation(FQuat(FRotator(Rotations[Offset].X, Rotations[Offset].Y, Rotations[Offset].Z)));
+        }
+        if (Scales.Num() > 0)
+        {
+            InstanceTransform.SetScale3D(Scales[Offset]);
+        }
+    }
+
+    Component->Modify();
+    if (bContiguous && Count > 0)
+    {
+        Component->BatchUpdateInstancesTransforms(Indices[0], NewTransforms, bWorldSpace, true, true);
+    }
+    else
+    {
+        for (int32 Offset = 0; Offset < Count; ++Offset)
+        {
+            Component->UpdateInstanceTransform(Indices[Offset], NewTransforms[Offset], bWorldSpace, false, true);
+        }
+        Component->MarkRenderStateDirty();
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("component_name"), Component->GetName());
+    ResultObj->SetNumberField(TEXT("updated"), Count);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPInstanceCommands::HandleRemoveMeshInstances(const TSharedPtr<FJsonObject>& Params)
+{
+    FString ErrorMessage;
+    UHierarchicalInstancedStaticMeshComponent* Component = FindInstancedComponent(Params, ErrorMessage);
+    if (!Component)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+    }
+
+    TArray<int32> Indices;
+    FUnrealMCPCommonUtils::GetIntArrayFromJson(Params, TEXT("indices"), Indices);
+
+    bool bClearAll = false;
+    Params->TryGetBoolField(TEXT("all"), bClearAll);
+
+    const int32 PreviousCount = Component->GetInstanceCount();
+    Component->Modify();
+    if (bClearAll)
+    {
+        Component->ClearInstances();
+    }
+    else if (Indices.Num() > 0)
+    {
+        // Removing an index twice would remove whichever instance moved into its slot
+        Indices.Sort();
+        Indices.SetNum(Algo::Unique(Indices));
+        for (int32 Index : Indices)
+        {
+            if (!Component->IsValidInstance(Index))
+            {
+                return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Invalid instance index: %d"), Index));
+            }
+        }
+        Component->RemoveInstances(Indices);
+    }
+    else
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Provide 'indices' or set 'all' to true"));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("component_name"), Component->GetName());
+    ResultObj->SetNumberField(TEXT("removed"), PreviousCount - Component->GetInstanceCount());
+    ResultObj->SetNumberField(TEXT("instance_count"), Component->GetInstanceCount());
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPInstanceCommands::HandleScatterInstances(const TSharedPtr<FJsonObject>& Params)
+{
+    // Get required parameters
+    FString MeshPath;
+    if (!Params->TryGetStringField(TEXT("mesh"), MeshPath))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'mesh' parameter"));
+    }
+
+    FString HostActorName;
+    if (!Params->TryGetStringField(TEXT("actor_name"), HostActorName))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'actor_name' parameter"));
+    }
+
+    // Get optional parameters
+    FString MaterialPath;
+    Params->TryGetStringField(TEXT("material"), MaterialPath);
+
+    FString ComponentName;
+    Params->TryGetStringField(TEXT("component_name"), ComponentName);
+
+    FString Mode = TEXT("poisson");
+    Params->TryGetStringField(TEXT("mode"), Mode);
+
+    double Density = 1.0;
+    Params->TryGetNumberField(TEXT("density"), Density);
+
+    double MinSpacing = 0.0;
+    Params->TryGetNumberField(TEXT("min_spacing"), MinSpacing);
+
+    double Jitter = 1.0;
+    Params->TryGetNumberField(TEXT("jitter"), Jitter);
+
+    int32 Seed = 0;
+    Params->TryGetNumberField(TEXT("seed"), Seed);
+
+    int32 MaxInstances = 100000;
+    Params->TryGetNumberField(TEXT("max_instances"), MaxInstances);
+
+    double ScaleMin = 1.0;
+    double ScaleMax = 1.0;
+    Params->TryGetNumberField(TEXT("scale_min"), ScaleMin);
+    Params->TryGetNumberField(TEXT("scale_max"), ScaleMax);
+
+    double ZOffset = 0.0;
+    Params->TryGetNumberField(TEXT("z_offset"), ZOffset);
+
+    bool bRandomYaw = true;
+    Params->TryGetBoolField(TEXT("random_yaw"), bRandomYaw);
+
+    bool bAlignToSurface = false;
+    Params->TryGetBoolField(TEXT("align_to_surface"), bAlignToSurface);
+
+    bool bTraceToGround = true;
+    Params->TryGetBoolField(TEXT("trace_to_ground"), bTraceToGround);
+
+    bool bClearExisting = false;
+    Params->TryGetBoolField(TEXT("clear_existing"), bClearExisting);
+
+    const bool bGrid = Mode == TEXT("grid");
+    const bool bPoisson = Mode == TEXT("poisson");
+    if (!bGrid && !bPoisson && Mode != TEXT("jitter"))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown scatter mode: %s (expected grid, jitter or poisson)"), *Mode));
+    }
+
+    if (Density <= 0.0)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("'density' must be greater than zero"));
+    }
+
+    if (ScaleMax < ScaleMin)
+    {
+        Swap(ScaleMin, ScaleMax);
+    }
+
+    // Density is instances per square meter
+    const double AreaPerInstance = 10000.0 / Density;
+    if (bPoisson && MinSpacing <= 0.0)
+    {
+        MinSpacing = 0.5 * FMath::Sqrt(AreaPerInstance);
+    }
+
+    // Poisson cells are small enough to hold at most one sample at the minimum spacing;
+    // grid and jitter cells hold exactly one sample at the requested density
+    const double CellSize = FMath::Max(1.0, bPoisson ? MinSpacing / UE_DOUBLE_SQRT_2 : FMath::Max(FMath::Sqrt(AreaPerInstance), MinSpacing));
+    const double AcceptProbability = bPoisson ? FMath::Min(1.0, CellSize * CellSize / AreaPerInstance) : 1.0;
+    const double JitterAmount = bGrid ? 0.0 : FMath::Clamp(Jitter, 0.0, 1.0);
+
+    UStaticMesh* Mesh = Cast<UStaticMesh>(UEditorAssetLibrary::LoadAsset(MeshPath));
+    if (!Mesh)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to load mesh: %s"), *MeshPath));
+    }
+
+    UMaterialInterface* Material = nullptr;
+    if (!MaterialPath.IsEmpty())
+    {
+        Material = Cast<UMaterialInterface>(UEditorAssetLibrary::LoadAsset(MaterialPath));
+        if (!Material)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to load material: %s"), *MaterialPath));
+        }
+    }
+
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
+    FScatterRegion Region;
+    FString ErrorMessage;
+    if (!GetScatterRegionFromJson(World, Params, Region, ErrorMessage))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+    }
+
+    const FVector RegionSize = Region.Bounds.GetSize();
+    const int64 NumX = FMath::Max<int64>(1, FMath::CeilToInt64(RegionSize.X / CellSize));
+    const int64 NumY = FMath::Max<int64>(1, FMath::CeilToInt64(RegionSize.Y / CellSize));
+    const int64 NumCells = NumX * NumY;
+    if (NumCells > FMath::Min<int64>(MAX_int32, static_cast<int64>(MaxInstances) * 8))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(
+            TEXT("Region needs %lld sample cells at this density, raise 'max_instances' or lower 'density'"), NumCells));
+    }
+
+    const int32 CellsX = static_cast<int32>(NumX);
+
+    // Generate one candidate per cell. Each cell draws from its own stream seeded by (seed, cell),
+    // so the result does not depend on how cells are split across worker threads.
+    struct FScatterCandidate
+    {
+        FVector Location;
+        float Yaw;
+        float Scale;
+        bool bValid;
+    };
+
+    TArray<FScatterCandidate> Candidates;
+    Candidates.SetNumUninitialized(static_cast<int32>(NumCells));
+    ParallelFor(static_cast<int32>(NumCells), [&](int32 CellIndex)
+    {
+        const int32 CellX = CellIndex % CellsX;
+        const int32 CellY = CellIndex / CellsX;
+        FRandomStream Stream(static_cast<int32>(HashCombine(GetTypeHash(Seed), GetTypeHash(CellIndex))));
+
+        // Always draw every value in the same order
+        const double OffsetX = Stream.FRand();
+        const double OffsetY = Stream.FRand();
+        const double Keep = Stream.FRand();
+        const float Yaw = Stream.FRandRange(0.0f, 360.0f);
+        const float Scale = Stream.FRandRange(static_cast<float>(ScaleMin), static_cast<float>(ScaleMax));
+
+        FScatterCandidate& Candidate = Candidates[CellIndex];
+        Candidate.Location = FVector(
+            Region.Bounds.Min.X + (CellX + 0.5 + (OffsetX - 0.5) * JitterAmount) * CellSize,
+            Region.Bounds.Min.Y + (CellY + 0.5 + (OffsetY - 0.5) * JitterAmount) * CellSize,
+            Region.Bounds.Min.Z);
+        Candidate.Yaw = bRandomYaw ? Yaw : 0.0f;
+        Candidate.Scale = Scale;
+        Candidate.bValid = Keep < AcceptProbability &&
+            Candidate.Location.X <= Region.Bounds.Max.X &&
+            Candidate.Location.Y <= Region.Bounds.Max.Y &&
+            Region.Contains(FVector2D(Candidate.Location));
+    });
+
+    int32 CandidateCount = 0;
+    for (const FScatterCandidate& Candidate : Candidates)
+    {
+        CandidateCount += Candidate.bValid ? 1 : 0;
+    }
+
+    // Enforce the minimum spacing with a serial pass in cell order: a candidate is dropped
+    // if an already accepted candidate in an earlier neighbouring cell is too close
+    int32 RejectedBySpacing = 0;
+    if (MinSpacing > 0.0)
+    {
+        const int32 Reach = FMath::CeilToInt32(MinSpacing / CellSize);
+        const double MinSpacingSquared = MinSpacing * MinSpacing;
+        for (int32 CellIndex = 0; CellIndex < NumCells; ++CellIndex)
+        {
+            FScatterCandidate& Candidate = Candidates[CellIndex];
+            if (!Candidate.bValid)
+            {
+                continue;
+            }
+
+            const int32 CellX = CellIndex % CellsX;
+            const int32 CellY = CellIndex / CellsX;
+            bool bTooClose = false;
+            for (int32 NeighbourY = FMath::Max(0, CellY - Reach); NeighbourY <= CellY && !bTooClose; ++NeighbourY)
+            {
+                const int32 LastX = NeighbourY == CellY ? CellX - 1 : FMath::Min(CellsX - 1, CellX + Reach);
+                for (int32 NeighbourX = FMath::Max(0, CellX - Reach); NeighbourX <= LastX; ++NeighbourX)
+                {
+                    const FScatterCandidate& Neighbour = Candidates[NeighbourY * CellsX + NeighbourX];
+                    if (Neighbour.bValid && FVector2D::DistSquared(FVector2D(Neighbour.Location), FVector2D(Candidate.Location)) < MinSpacingSquared)
+                    {
+                        bTooClose = true;
+                        break;
+                    }
+                }
+            }
+
+            if (bTooClose)
+            {
+                Candidate.bValid = false;
+                ++RejectedBySpacing;
+            }
+        }
+    }
+
+    TArray<int32> Accepted;
+    Accepted.Reserve(CandidateCount - RejectedBySpacing);
+    for (int32 CellIndex = 0; CellIndex < NumCells; ++CellIndex)
+    {
+        if (Candidates[CellIndex].bValid)
+        {
+            Accepted.Add(CellIndex);
+        }
+    }
+
+    if (Accepted.Num() > MaxInstances)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(
+            TEXT("Scatter would create %d instances, above 'max_instances' (%d)"), Accepted.Num(), MaxInstances));
+    }
+
+    UHierarchicalInstancedStaticMeshComponent* Component = FindOrCreateInstancedComponent(World, HostActorName, ComponentName, Mesh, Material, ErrorMessage);
+    if (!Component)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+    }
+
+    // Ground traces are read-only scene queries, so run them on worker threads as well
+    TArray<FTransform> Transforms;
+    TArray<bool> Placed;
+    Transforms.SetNum(Accepted.Num());
+    Placed.Init(true, Accepted.Num());
+
+    FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(UnrealMCPScatter), true);
+    QueryParams.AddIgnoredActor(Component->GetOwner());
+
+    ParallelFor(Accepted.Num(), [&](int32 Index)
+    {
+        const FScatterCandidate& Candidate = Candidates[Accepted[Index]];
+        FVector Location = Candidate.Location;
+        FVector Normal = FVector::UpVector;
+
+        if (bTraceToGround)
+        {
+            FHitResult Hit;
+            const FVector Start(Location.X, Location.Y, Region.Bounds.Max.Z + Region.TraceHeight);
+            const FVector End(Location.X, Location.Y, Region.Bounds.Min.Z - Region.TraceHeight);
+            if (!World->LineTraceSingleByChannel(Hit, Start, End, ECC_Visibility, QueryParams))
+            {
+                Placed[Index] = false;
+                return;
+            }
+            Location = Hit.ImpactPoint;
+            Normal = Hit.ImpactNormal;
+        }
+
+        FQuat Rotation(FVector::UpVector, FMath::DegreesToRadians(Candidate.Yaw));
+        if (bAlignToSurface)
+        {
+            Rotation = FQuat::FindBetweenNormals(FVector::UpVector, Normal) * Rotation;
+        }
+
+        Transforms[Index] = FTransform(Rotation, Location + (bAlignToSurface ? Normal : FVector::UpVector) * ZOffset, FVector(Candidate.Scale));
+    });
+
+    // Compact in cell order so the instance order is stable for a given seed
+    int32 DroppedNoHit = 0;
+    TArray<FTransform> PlacedTransforms;
+    PlacedTransforms.Reserve(Transforms.Num());
+    for (int32 Index = 0; Index < Transforms.Num(); ++Index)
+    {
+        if (Placed[Index])
+        {
+            PlacedTransforms.Add(Transforms[Index]);
+        }
+        else
+        {
+            ++DroppedNoHit;
+        }
+    }
+
+    Component->Modify();
+    if (bClearExisting)
+    {
+        Component->ClearInstances();
+    }
+    const TArray<int32> NewIndices = Component->AddInstances(PlacedTransforms, true, true);
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("actor_name"), Component->GetOwner()->GetName());
+    ResultObj->SetStringField(TEXT("component_name"), Component->GetName());
+    ResultObj->SetStringField(TEXT("mode"), Mode);
+    ResultObj->SetNumberField(TEXT("seed"), Seed);
+    ResultObj->SetNumberField(TEXT("cell_size"), CellSize);
+    ResultObj->SetNumberField(TEXT("candidates"), CandidateCount);
+    ResultObj->SetNumberField(TEXT("rejected_by_spacing"), RejectedBySpacing);
+    ResultObj->SetNumberField(TEXT("dropped_no_hit"), DroppedNoHit);
+    ResultObj->SetNumberField(TEXT("added"), NewIndices.Num());
+    ResultObj->SetNumberField(TEXT("first_index"), NewIndices.Num() > 0 ? NewIndices[0] : INDEX_NONE);
+    ResultObj->SetNumberField(TEXT("instance_count"), Component->GetInstanceCount());
+    return ResultObj;
+}
+
+bool FUnrealMCPInstanceCommands::GetScatterRegionFromJson(UWorld* World, const TSharedPtr<FJsonObject>& Params, FScatterRegion& OutRegion, FString& OutErrorMessage)
+{
+    FString RegionType = TEXT("box");
+    Params->TryGetStringField(TEXT("region"), RegionType);
+
+    // Ground traces reach this far above and below the region, so a flat box or spline still finds the ground
+    double TraceHeight = 10000.0;
+    Params->TryGetNumberField(TEXT("trace_height"), TraceHeight);
+
+    OutRegion.Bounds = FBox(ForceInit);
+    OutRegion.Polygon.Reset();
+    OutRegion.TraceHeight = TraceHeight;
+
+    if (RegionType == TEXT("box"))
+    {
+        if (!Params->HasField(TEXT("min")) || !Params->HasField(TEXT("max")))
+        {
+            OutErrorMessage = TEXT("Box region requires 'min' and 'max' parameters");
+            return false;
+        }
+
+        const FVector Min = FUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("min"));
+        const FVector Max = FUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("max"));
+        OutRegion.Bounds = FBox(Min.ComponentMin(Max), Min.ComponentMax(Max));
+    }
+    else if (RegionType == TEXT("spline"))
+    {
+        FString SplineActorName;
+        if (!Params->TryGetStringField(TEXT("spline_actor"), SplineActorName))
+        {
+            OutErrorMessage = TEXT("Spline region requires a 'spline_actor' parameter");
+            return false;
+        }
+
+        USplineComponent* Spline = nullptr;
+        for (TActorIterator<AActor> It(World); It; ++It)
+        {
+            if (It->GetName() == SplineActorName)
+            {
+                Spline = It->FindComponentByClass<USplineComponent>();
+                break;
+            }
+        }
+
+        if (!Spline)
+        {
+            OutErrorMessage = FString::Printf(TEXT("No spline component found on actor: %s"), *SplineActorName);
+            return false;
+        }
+
+        // Treat the spline as a closed outline and sample it into a polygon
+        const int32 NumSamples = FMath::Clamp(Spline->GetNumberOfSplinePoints() * 16, 16, 4096);
+        const float SplineLength = Spline->GetSplineLength();
+        for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+        {
+            const FVector Point = Spline->GetLocationAtDistanceAlongSpline(SplineLength * Sample / NumSamples, ESplineCoordinateSpace::World);
+            OutRegion.Polygon.Add(FVector2D(Point));
+            OutRegion.Bounds += Point;
+        }
+    }
+    else if (RegionType == TEXT("landscape"))
+    {
+        FString LandscapeName;
+        Params->TryGetStringField(TEXT("landscape_actor"), LandscapeName);
+
+        for (TActorIterator<ALandscapeProxy> It(World); It; ++It)
+        {
+            if (LandscapeName.IsEmpty() || It->GetName() == LandscapeName)
+            {
+                OutRegion.Bounds += It->GetComponentsBoundingBox(true);
+            }
+        }
+
+        if (!OutRegion.Bounds.IsValid)
+        {
+            OutErrorMessage = LandscapeName.IsEmpty() ? FString(TEXT("No landscape found in level")) : FString::Printf(TEXT("Landscape not found: %s"), *LandscapeName);
+            return false;
+        }
+        OutRegion.Bounds = OutRegion.Bounds.ExpandBy(FVector(0.0, 0.0, 100.0));
+    }
+    else
+    {
+        OutErrorMessage = FString::Printf(TEXT("Unknown region type: %s (expected box, spline or landscape)"), *RegionType);
+        return false;
+    }
+
+    const FVector Size = OutRegion.Bounds.GetSize();
+    if (Size.X <= 0.0 || Size.Y <= 0.0)
+    {
+        OutErrorMessage = TEXT("Scatter region has no area");
+        return false;
+    }
+    return true;
+}
+
+bool FUnrealMCPInstanceCommands::FScatterRegion::Contains(const FVector2D& Point) const
+{
+    if (Polygon.Num() < 3)
+    {
+        return true;
+    }
+
+    // Even-odd crossing test
+    bool bInside = false;
+    for (int32 Index = 0, Previous = Polygon.Num() - 1; Index < Polygon.Num(); Previous = Index++)
+    {
+        const FVector2D& A = Polygon[Index];
+        const FVector2D& B = Polygon[Previous];
+        if ((A.Y > Point.Y) != (B.Y > Point.Y) &&
+            Point.X < (B.X - A.X) * (Point.Y - A.Y) / (B.Y - A.Y) + A.X)
+        {
+            bInside = !bInside;
+        }
+    }
+    return bInside;
+}
+
+UHierarchicalInstancedStaticMeshComponent* FUnrealMCPInstanceCommands::FindOrCreateInstancedComponent(UWorld* World, const FString& HostActorName,
+                                                                                                      const FString& ComponentName, UStaticMesh* Mesh,
+                                                                                                      UMaterialInterface* Material, FString& OutErrorMessage)
+{
+    // Find the host actor, spawning an empty one if needed
+    AActor* HostActor = FindHostActor(World, HostActorName);
+    if (!HostActor)
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.Name = *HostActorName;
+        HostActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+        if (!HostActor)
+        {
+            OutErrorMessage = FString::Printf(TEXT("Failed to spawn host actor: %s"), *HostActorName);
+            return nullptr;
+        }
+
+        // A scene root gives the host a transform that can be moved in the editor, with the instanced components under it
+        USceneComponent* Root = NewObject<USceneComponent>(HostActor, TEXT("Root"), RF_Transactional);
+        Root->Mobility = EComponentMobility::Static;
+        HostActor->SetRootComponent(Root);
+        HostActor->AddInstanceComponent(Root);
+        Root->RegisterComponent();
+        HostActor->SetActorLabel(HostActorName);
+    }
+
+    // Reuse an existing component by name, or one that already renders this mesh and material
+    TArray<UHierarchicalInstancedStaticMeshComponent*> Components;
+    HostActor->GetComponents(Components);
+    for (UHierarchicalInstancedStaticMeshComponent* Existing : Components)
+    {
+        if (!ComponentName.IsEmpty())
+        {
+            if (Existing->GetName() == ComponentName)
+            {
+                if (Existing->GetStaticMesh() != Mesh)
+                {
+                    OutErrorMessage = FString::Printf(TEXT("Component '%s' already uses a different mesh"), *ComponentName);
+                    return nullptr;
+                }
+                if (Material && Existing->GetMaterial(0) != Material)
+                {
+                    Existing->Modify();
+                    Existing->SetMaterial(0, Material);
+                }
+                return Existing;
+            }
+        }
+        else if (Existing->GetStaticMesh() == Mesh && (!Material || Existing->GetMaterial(0) == Material))
+        {
+            return Existing;
+        }
+    }
+
+    const FName NewComponentName = ComponentName.IsEmpty()
+        ? MakeUniqueObjectName(HostActor, UHierarchicalInstancedStaticMeshComponent::StaticClass(), *FString::Printf(TEXT("HISM_%s"), *Mesh->GetName()))
+        : FName(*ComponentName);
+
+    HostActor->Modify();
+    UHierarchicalInstancedStaticMeshComponent* Component = NewObject<UHierarchicalInstancedStaticMeshComponent>(HostActor, NewComponentName, RF_Transactional);
+    Component->SetStaticMesh(Mesh);
+    if (Material)
+    {
+        Component->SetMaterial(0, Material);
+    }
+
+    if (USceneComponent* Root = HostActor->GetRootComponent())
+    {
+        Component->SetupAttachment(Root);
+    }
+    else
+    {
+        HostActor->SetRootComponent(Component);
+    }
+
+    HostActor->AddInstanceComponent(Component);
+    Component->RegisterComponent();
+    return Component;
+}
+
+UHierarchicalInstancedStaticMeshComponent* FUnrealMCPInstanceCommands::FindInstancedComponent(const TSharedPtr<FJsonObject>& Params, FString& OutErrorMessage)
+{
+    FString HostActorName;
+    if (!Params->TryGetStringField(TEXT("actor_name"), HostActorName))
+    {
+        OutErrorMessage = TEXT("Missing 'actor_name' parameter");
+        return nullptr;
+    }
+
+    FString ComponentName;
+    Params->TryGetStringField(TEXT("component_name"), ComponentName);
+
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        OutErrorMessage = TEXT("Failed to get editor world");
+        return nullptr;
+    }
+
+    AActor* HostActor = FindHostActor(World, HostActorName);
+    if (!HostActor)
+    {
+        OutErrorMessage = FString::Printf(TEXT("Actor not found: %s"), *HostActorName);
+        return nullptr;
+    }
+
+    TArray<UHierarchicalInstancedStaticMeshComponent*> Components;
+    HostActor->GetComponents(Components);
+    for (UHierarchicalInstancedStaticMeshComponent* Component : Components)
+    {
+        if (ComponentName.IsEmpty() || Component->GetName() == ComponentName)
+        {
+            return Component;
+        }
+    }
+
+    OutErrorMessage = FString::Printf(TEXT("No instanced mesh component '%s' on actor '%s'"), *ComponentName, *HostActorName);
+    return nullptr;
+}
+
+AActor* FUnrealMCPInstanceCommands::FindHostActor(UWorld* World, const FString& HostActorName)
+{
+    // By name or outliner label; hosts spawned by these commands are labelled with the name they were asked for
+    for (TActorIterator<AActor> It(World); It; ++It)
+    {
+        if (It->GetName() == HostActorName || It->GetActorLabel() == HostActorName)
+        {
+            return *It;
+        }
+    }
+    return nullptr;
+}
+
+bool FUnrealMCPInstanceCommands::GetTransformsFromJson(const FUnrealMCPJsonView& Params, TArray<FTransform>& OutTransforms, FString& OutErrorMessage)
+{
+    OutTransforms.Reset();
+
+    // Array-of-structs form: [{ "location": [...], "rotation": [...], "scale": [...] }, ...]
+    FUnrealMCPJsonView TransformArray;
+    if (Params.TryGetArrayField(TEXT("transforms"), TransformArray))
+    {
+        bool bValid = true;
+        OutTransforms.Reserve(TransformArray.Num());
+        TransformArray.ForEachElement([&OutTransforms, &bValid](const FUnrealMCPJsonView& TransformObj)
+        {
+            if (!TransformObj.IsObject())
+            {
+                bValid = false;
+                return;
+            }
+
+            FVector Scale(1.0f, 1.0f, 1.0f);
+            if (TransformObj.HasField(TEXT("scale")))
+            {
+                Scale = FUnrealMCPCommonUtils::GetVectorFromJson(TransformObj, TEXT("scale"));
+            }
+            OutTransforms.Add(FTransform(
+                FUnrealMCPCommonUtils::GetRotatorFromJson(TransformObj, TEXT("rotation")),
+                FUnrealMCPCommonUtils::GetVectorFromJson(TransformObj, TEXT("location")),
+                Scale));
+        });
+
+        if (!bValid)
+        {
+            OutErrorMessage = TEXT("Each entry of 'transforms' must be an object");
+            return false;
+        }
+        return true;
+    }
+
+    // Structure-of-arrays form, same layout as set_actor_transforms
+    TArray<FVector> Locations;
+    TArray<FVector> Rotations;
+    TArray<FVector> Scales;
+    if (!FUnrealMCPCommonUtils::GetPackedVectorArrayFromJson(Params, TEXT("locations"), Locations, OutErrorMessage) ||
+        !FUnrealMCPCommonUtils::GetPackedVectorArrayFromJson(Params, TEXT("rotations"), Rotations, OutErrorMessage) ||
+        !FUnrealMCPCommonUtils::GetPackedVectorArrayFromJson(Params, TEXT("scales"), Scales, OutErrorMessage))
+    {
+        return false;
+    }
+
+    if (Locations.Num() == 0)
+    {
+        OutErrorMessage = TEXT("Missing 'transforms' or 'locations' parameter");
+        return false;
+    }
+
+    const int32 Count = Locations.Num();
+    if ((Rotations.Num() > 0 && Rotations.Num() != Count) || (Scales.Num() > 0 && Scales.Num() != Count))
+    {
+        OutErrorMessage = FString::Printf(TEXT("Array length mismatch: %d locations, %d rotations, %d scales"),
+            Count, Rotations.Num(), Scales.Num());
+        return false;
+    }
+
+    OutTransforms.SetNum(Count);
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        const FRotator Rotation = Rotations.Num() > 0 ? FRotator(Rotations[Index].X, Rotations[Index].Y, Rotations[Index].Z) : FRotator::ZeroRotator;
+        const FVector Scale = Scales.Num() > 0 ? Scales[Index] : FVector::OneVector;
+        OutTransforms[Index] = FTransform(Rotation, Locations[Index], Scale);
+    }
+    return true;
+}
@@ -0,0 +1,179 @@
+#include "Commands/UnrealMCPInvalidation.h"
+#include "Commands/UnrealMCPBlueprintIndex.h"
+#include "Commands/UnrealMCPClassSchema.h"
+#include "Commands/UnrealMCPCompileQueue.h"
+#include "Commands/UnrealMCPFunctionIndex.h"
+#include "Commands/UnrealMCPGraphExport.h"
+#include "Commands/UnrealMCPNodeSearch.h"
+#include "Commands/UnrealMCPPropertyPath.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "UObject/Package.h"
+#include "UObject/ObjectSaveContext.h"
+#include "Misc/CoreDelegates.h"
+#include "Editor.h"
+
+FDelegateHandle FUnrealMCPInvalidation::PostEngineInitHandle;
+FDelegateHandle FUnrealMCPInvalidation::BlueprintCompiledHandle;
+FDelegateHandle FUnrealMCPInvalidation::ObjectsReinstancedHandle;
+FDelegateHandle FUnrealMCPInvalidation::ReloadCompleteHandle;
+FDelegateHandle FUnrealMCPInvalidation::ModulesChangedHandle;
+FDelegateHandle FUnrealMCPInvalidation::AssetAddedHandle;
+FDelegateHandle FUnrealMCPInvalidation::AssetRemovedHandle;
+FDelegateHandle FUnrealMCPInvalidation::AssetRenamedHandle;
+FDelegateHandle FUnrealMCPInvalidation::PackageMarkedDirtyHandle;
+FDelegateHandle FUnrealMCPInvalidation::PackageSavedHandle;
+FDelegateHandle FUnrealMCPInvalidation::ObjectModifiedHandle;
+FDelegateHandle FUnrealMCPInvalidation::ObjectPropertyChangedHandle;
+
+void FUnrealMCPInvalidation::Startup()
+{
+    // GEditor may not exist yet when the module starts
+    if (GEditor)
+    {
+        BindEditorDelegates();
+    }
+    else
+    {
+        PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddStatic(&FUnrealMCPInvalidation::BindEditorDelegates);
+    }
+    ObjectsReinstancedHandle = FCoreUObjectDelegates::OnObjectsReinstanced.AddStatic(&FUnrealMCPInvalidation::OnObjectsReinstanced);
+    ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddStatic(&FUnrealMCPInvalidation::OnReloadComplete);
+    ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddStatic(&FUnrealMCPInvalidation::OnModulesChanged);
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+    AssetAddedHandle = AssetRegistry.OnAssetAdded().AddStatic(&FUnrealMCPInvalidation::OnAssetAdded);
+    AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddStatic(&FUnrealMCPInvalidation::OnAssetRemoved);
+    AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddStatic(&FUnrealMCPInvalidation::OnAssetRenamed);
+
+    PackageMarkedDirtyHandle = UPackage::PackageMarkedDirtyEvent.AddStatic(&FUnrealMCPInvalidation::OnPackageMarkedDirty);
+    PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddStatic(&FUnrealMCPInvalidation::OnPackageSaved);
+
+    ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddStatic(&FUnrealMCPInvalidation::OnObjectModified);
+    ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddStatic(&FUnrealMCPInvalidation::OnObjectPropertyChanged);
+}
+
+void FUnrealMCPInvalidation::Shutdown()
+{
+    FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+    if (GEditor)
+    {
+        GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+    }
+    FCoreUObjectDelegates::OnObjectsReinstanced.Remove(ObjectsReinstancedHandle);
+    FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+    FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
+
+    // The asset registry may already be gone when the editor is shutting down
+    if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+    {
+        IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+        AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+        AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+    }
+
+    UPackage::PackageMarkedDirtyEvent.Remove(PackageMarkedDirtyHandle);
+    UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+    FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+
+    PostEngineInitHandle.Reset();
+    BlueprintCompiledHandle.Reset();
+    ObjectsReinstancedHandle.Reset();
+    ReloadCompleteHandle.Reset();
+    ModulesChangedHandle.Reset();
+    AssetAddedHandle.Reset();
+    AssetRemovedHandle.Reset();
+    AssetRenamedHandle.Reset();
+    PackageMarkedDirtyHandle.Reset();
+    PackageSavedHandle.Reset();
+    ObjectModifiedHandle.Reset();
+    ObjectPropertyChangedHandle.Reset();
+}
+
+void FUnrealMCPInvalidation::BindEditorDelegates()
+{
+    if (GEditor && !BlueprintCompiledHandle.IsValid())
+    {
+        BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddStatic(&FUnrealMCPInvalidation::OnBlueprintCompiled);
+    }
+}
+
+void FUnrealMCPInvalidation::ClearClassCaches()
+{
+    FUnrealMCPPropertyPath::ClearCache();
+    FUnrealMCPClassSchema::ClearCache();
+
+    // Compiles and reloads reconstruct nodes without necessarily modifying them
+    FUnrealMCPGraphExport::ClearCache();
+}
+
+void FUnrealMCPInvalidation::OnBlueprintCompiled()
+{
+    ClearClassCaches();
+}
+
+void FUnrealMCPInvalidation::OnObjectsReinstanced(const TMap<UObject*, UObject*>& OldToNewInstanceMap)
+{
+    ClearClassCaches();
+}
+
+void FUnrealMCPInvalidation::OnReloadComplete(EReloadCompleteReason Reason)
+{
+    ClearClassCaches();
+
+    // A reload can change native parents without touching any blueprint content
+    FUnrealMCPCompileQueue::Records.Reset();
+
+    // and replaces class objects wholesale
+    FUnrealMCPFunctionIndex::Rebuild();
+}
+
+void FUnrealMCPInvalidation::OnModulesChanged(FName ModuleName, EModuleChangeReason Reason)
+{
+    if (Reason == EModuleChangeReason::ModuleLoaded)
+    {
+        FUnrealMCPFunctionIndex::AddModuleClasses(ModuleName);
+    }
+}
+
+void FUnrealMCPInvalidation::OnAssetAdded(const FAssetData& AssetData)
+{
+    FUnrealMCPBlueprintIndex::AddAsset(AssetData);
+}
+
+void FUnrealMCPInvalidation::OnAssetRemoved(const FAssetData& AssetData)
+{
+    FUnrealMCPBlueprintIndex::RemoveAsset(AssetData.AssetName, AssetData.GetSoftObjectPath());
+    FUnrealMCPNodeSearch::RemovePackage(AssetData.PackageName);
+}
+
+void FUnrealMCPInvalidation::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    FUnrealMCPBlueprintIndex::OnAssetRenamed(AssetData, OldObjectPath);
+}
+
+void FUnrealMCPInvalidation::OnPackageMarkedDirty(UPackage* Package, bool bWasDirty)
+{
+    // Any edit to a loaded blueprint dirties its package
+    FUnrealMCPNodeSearch::MarkStale(Package->GetFName());
+}
+
+void FUnrealMCPInvalidation::OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext)
+{
+    // A save changes the hash stored records are compared against
+    FUnrealMCPNodeSearch::MarkStale(Package->GetFName());
+}
+
+void FUnrealMCPInvalidation::OnObjectModified(UObject* Object)
+{
+    // Node moves, pin edits and links all Modify the node or graph first
+    FUnrealMCPGraphExport::OnObjectChanged(Object);
+}
+
+void FUnrealMCPInvalidation::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+    // Undo and redo, and MarkBlueprintAsModified, arrive here without a Modify
+    FUnrealMCPGraphExport::OnObjectChanged(Object);
+}
@@ -0,0 +1,454 @@
+#include "Commands/UnrealMCPNodeSearch.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Variable.h"
+#include "K2Node_Event.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "IO/IoHash.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "UObject/Package.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Algo/Unique.h"
+
+// Bump when FNodeRecord changes so stale files are ignored rather than misread
+static constexpr int32 NodeSearchIndexVersion = 1;
+
+// Seconds between the first unsaved change and writing the index, so a run of searches writes it once
+static constexpr float NodeSearchSaveDelaySeconds = 5.0f;
+
+bool FUnrealMCPNodeSearch::bLoaded = false;
+bool FUnrealMCPNodeSearch::bDirty = false;
+TMap<FName, FUnrealMCPNodeSearch::FEntry> FUnrealMCPNodeSearch::Entries;
+FTSTicker::FDelegateHandle FUnrealMCPNodeSearch::SaveTickerHandle;
+
+// Unindexed blueprints listed by name in a response; the count covers the rest
+static constexpr int32 NodeSearchMaxUnindexedListed = 50;
+
+TSharedPtr<FJsonObject> FUnrealMCPNodeSearch::Search(const TArray<FAssetData>& Assets, const FQuery& Query, int32 MaxResults, bool bLoadAssets)
+{
+    EnsureLoaded();
+
+    TArray<TSharedPtr<FJsonValue>> Results;
+    TArray<TSharedPtr<FJsonValue>> Unindexed;
+    int32 UnindexedCount = 0;
+    int32 MatchCount = 0;
+    int32 IndexedCount = 0;
+    int32 LoadedCount = 0;
+    TArray<int32> Candidates;
+    for (const FAssetData& AssetData : Assets)
+    {
+        const FEntry* Entry = GetEntry(AssetData, bLoadAssets, IndexedCount, LoadedCount);
+        if (!Entry)
+        {
+            if (UnindexedCount++ < NodeSearchMaxUnindexedListed)
+            {
+                Unindexed.Add(MakeShared<FJsonValueString>(AssetData.PackageName.ToString()));
+            }
+            continue;
+        }
+
+        GetCandidates(*Entry, Query, Candidates);
+        for (const int32 NodeIndex : Candidates)
+        {
+            const FNodeRecord& Record = Entry->Nodes[NodeIndex];
+            if (!Matches(Record, Query))
+            {
+                continue;
+            }
+
+            // Keep counting past the limit so callers know how much they are missing
+            if (MatchCount++ >= MaxResults)
+            {
+                continue;
+            }
+
+            TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+            ResultObj->SetStringField(TEXT("blueprint"), AssetData.PackageName.ToString());
+            ResultObj->SetStringField(TEXT("graph"), Record.Graph);
+            ResultObj->SetStringField(TEXT("node_id"), Record.NodeGuid);
+            ResultObj->SetStringField(TEXT("node_class"), Record.NodeClass);
+            ResultObj->SetStringField(TEXT("title"), Record.Title);
+            if (!Record.Function.IsEmpty())
+            {
+                ResultObj->SetStringField(TEXT("function"), Record.Function);
+            }
+            if (!Record.Variable.IsEmpty())
+            {
+                ResultObj->SetStringField(TEXT("variable"), Record.Variable);
+            }
+            if (!Record.Event.IsEmpty())
+            {
+                ResultObj->SetStringField(TEXT("event"), Record.Event);
+            }
+            if (!Record.Comment.IsEmpty())
+            {
+                ResultObj->SetStringField(TEXT("comment"), Record.Comment);
+            }
+            Results.Add(MakeShared<FJsonValueObject>(ResultObj));
+        }
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetArrayField(TEXT("results"), Results);
+    ResultObj->SetNumberField(TEXT("total_matches"), MatchCount);
+    ResultObj->SetBoolField(TEXT("truncated"), MatchCount > Results.Num());
+    ResultObj->SetNumberField(TEXT("searched_count"), Assets.Num());
+    ResultObj->SetNumberField(TEXT("indexed_count"), IndexedCount);
+    ResultObj->SetNumberField(TEXT("loaded_count"), LoadedCount);
+
+    // Blueprints skipped because answering for them would mean loading them
+    ResultObj->SetNumberField(TEXT("unindexed_count"), UnindexedCount);
+    if (UnindexedCount > 0)
+    {
+        ResultObj->SetArrayField(TEXT("unindexed"), Unindexed);
+        ResultObj->SetStringField(TEXT("unindexed_hint"), TEXT("Pass load_assets=true to load and index these blueprints"));
+    }
+    return ResultObj;
+}
+
+void FUnrealMCPNodeSearch::Reset()
+{
+    Entries.Reset();
+    bDirty = false;
+    IFileManager::Get().Delete(*GetIndexPath(), false, false, true);
+}
+
+void FUnrealMCPNodeSearch::Shutdown()
+{
+    if (SaveTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(SaveTickerHandle);
+        SaveTickerHandle.Reset();
+    }
+    SaveIfDirty();
+}
+
+const FUnrealMCPNodeSearch::FEntry* FUnrealMCPNodeSearch::GetEntry(const FAssetData& AssetData, bool bLoadAssets, int32& InOutIndexedCount, int32& InOutLoadedCount)
+{
+    FEntry* Entry = Entries.Find(AssetData.PackageName);
+    UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.FastGetAsset(false));
+
+    if (Blueprint)
+    {
+        // Loaded: the dirty and saved events flag every edit made in this session. Records read
+        // from disk also have to come from the file that is loaded now, which the events cannot vouch for.
+        const bool bPackageDirty = Blueprint->GetPackage()->IsDirty();
+        if (Entry && !Entry->bStale &&
+            (bPackageDirty || Entry->SavedHash.IsEmpty() || Entry->SavedHash == GetSavedHash(AssetData.PackageName)))
+        {
+            return Entry;
+        }
+    }
+    else
+    {
+        // Not loaded: the records are good as long as the file is the one they were read from
+        const FString SavedHash = GetSavedHash(AssetData.PackageName);
+        if (Entry && !SavedHash.IsEmpty() && Entry->SavedHash == SavedHash)
+        {
+            return Entry;
+        }
+        if (!bLoadAssets)
+        {
+            return nullptr;
+        }
+
+        Blueprint = Cast<UBlueprint>(AssetData.GetAsset());
+        if (!Blueprint)
+        {
+            return nullptr;
+        }
+        ++InOutLoadedCount;
+    }
+
+    FEntry& NewEntry = Entries.FindOrAdd(AssetData.PackageName);
+    IndexBlueprint(Blueprint, NewEntry);
+    BuildLookup(NewEntry);
+    NewEntry.SavedHash = Blueprint->GetPackage()->IsDirty() ? FString() : GetSavedHash(AssetData.PackageName);
+    NewEntry.bStale = false;
+    MarkIndexDirty();
+    ++InOutIndexedCount;
+    return &NewEntry;
+}
+
+void FUnrealMCPNodeSearch::IndexBlueprint(UBlueprint* Blueprint, FEntry& OutEntry)
+{
+    OutEntry.Nodes.Reset();
+
+    TArray<UEdGraph*> Graphs;
+    Blueprint->GetAllGraphs(Graphs);
+    for (const UEdGraph* Graph : Graphs)
+    {
+        for (const UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (!Node)
+            {
+                continue;
+            }
+
+            FNodeRecord& Record = OutEntry.Nodes.AddDefaulted_GetRef();
+            Record.Graph = Graph->GetName();
+            Record.NodeGuid = Node->NodeGuid.ToString();
+            Record.NodeClass = Node->GetClass()->GetName();
+            Record.Title = Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
+            Record.Comment = Node->NodeComment;
+
+            if (const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+            {
+                Record.Function = CallNode->FunctionReference.GetMemberName().ToString();
+            }
+            else if (const UK2Node_Variable* VariableNode = Cast<UK2Node_Variable>(Node))
+            {
+                Record.Variable = VariableNode->GetVarName().ToString();
+            }
+            else if (const UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
+            {
+                Record.Event = EventNode->GetFunctionName().ToString();
+            }
+        }
+    }
+}
+
+void FUnrealMCPNodeSearch::BuildLookup(FEntry& InOutEntry)
+{
+    InOutEntry.NodesByFunction.Reset();
+    InOutEntry.NodesByVariable.Reset();
+    InOutEntry.NodesByEvent.Reset();
+    InOutEntry.NodesByClass.Reset();
+
+    for (int32 Index = 0; Index < InOutEntry.Nodes.Num(); ++Index)
+    {
+        const FNodeRecord& Record = InOutEntry.Nodes[Index];
+        InOutEntry.NodesByClass.FindOrAdd(FName(*Record.NodeClass)).Add(Index);
+        if (!Record.Function.IsEmpty())
+        {
+            InOutEntry.NodesByFunction.FindOrAdd(FName(*Record.Function)).Add(Index);
+        }
+        if (!Record.Variable.IsEmpty())
+        {
+            InOutEntry.NodesByVariable.FindOrAdd(FName(*Record.Variable)).Add(Index);
+        }
+        if (!Record.Event.IsEmpty())
+        {
+            InOutEntry.NodesByEvent.FindOrAdd(FName(*Record.Event)).Add(Index);
+        }
+    }
+}
+
+void FUnrealMCPNodeSearch::GetCandidates(const FEntry& Entry, const FQuery& Query, TArray<int32>& OutIndices)
+{
+    OutIndices.Reset();
+
+    // FNAME_Find: a name nobody has used cannot be referenced by any node
+    auto AppendKeyed = [&OutIndices](const TMap<FName, TArray<int32>>& ByName, const FString& Name)
+    {
+        const FName Key(*Name, FNAME_Find);
+        if (const TArray<int32>* Indices = Key.IsNone() ? nullptr : ByName.Find(Key))
+        {
+            OutIndices.Append(*Indices);
+        }
+    };
+
+    // The first keyed filter given narrows the records; Matches still applies every filter
+    if (!Query.FunctionName.IsEmpty())
+    {
+        AppendKeyed(Entry.NodesByFunction, Query.FunctionName);
+    }
+    else if (!Query.VariableName.IsEmpty())
+    {
+        AppendKeyed(Entry.NodesByVariable, Query.VariableName);
+    }
+    else if (!Query.EventName.IsEmpty())
+    {
+        AppendKeyed(Entry.NodesByEvent, Query.EventName);
+    }
+    else if (!Query.NodeClass.IsEmpty())
+    {
+        // The same spellings Matches accepts: as given, without a U prefix, or without K2Node_
+        AppendKeyed(Entry.NodesByClass, Query.NodeClass);
+        if (Query.NodeClass.Len() > 1 && (Query.NodeClass[0] == TEXT('U') || Query.NodeClass[0] == TEXT('u')))
+        {
+            AppendKeyed(Entry.NodesByClass, Query.NodeClass.RightChop(1));
+        }
+        AppendKeyed(Entry.NodesByClass, TEXT("K2Node_") + Query.NodeClass);
+        OutIndices.Sort();
+        OutIndices.SetNum(Algo::Unique(OutIndices));
+    }
+    else
+    {
+        // Only graph or comment filters: every record has to be tested
+        OutIndices.Reserve(Entry.Nodes.Num());
+        for (int32 Index = 0; Index < Entry.Nodes.Num(); ++Index)
+        {
+            OutIndices.Add(Index);
+        }
+    }
+}
+
+bool FUnrealMCPNodeSearch::Matches(const FNodeRecord& Record, const FQuery& Query)
+{
+    // Class names match with or without their U prefix, and K2 nodes without their K2Node_ prefix
+    if (!Query.NodeClass.IsEmpty() &&
+        !Record.NodeClass.Equals(Query.NodeClass, ESearchCase::IgnoreCase) &&
+        !(TEXT("U") + Record.NodeClass).Equals(Query.NodeClass, ESearchCase::IgnoreCase) &&
+        !Record.NodeClass.Equals(TEXT("K2Node_") + Query.NodeClass, ESearchCase::IgnoreCase))
+    {
+        return false;
+    }
+
+    return (Query.GraphName.IsEmpty() || Record.Graph.Equals(Query.GraphName, ESearchCase::IgnoreCase)) &&
+           (Query.FunctionName.IsEmpty() || Record.Function.Equals(Query.FunctionName, ESearchCase::IgnoreCase)) &&
+           (Query.VariableName.IsEmpty() || Record.Variable.Equals(Query.VariableName, ESearchCase::IgnoreCase)) &&
+           (Query.EventName.IsEmpty() || Record.Event.Equals(Query.EventName, ESearchCase::IgnoreCase)) &&
+           (Query.Comment.IsEmpty() || Record.Comment.Contains(Query.Comment, ESearchCase::IgnoreCase));
+}
+
+FString FUnrealMCPNodeSearch::GetSavedHash(FName PackageName)
+{
+    const IAssetRegistry& AssetRegistry = FAssetRegistryModule::GetRegistry();
+    const TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(PackageName);
+    return PackageData.IsSet() && !PackageData->GetPackageSavedHash().IsZero() ? LexToString(PackageData->GetPackageSavedHash()) : FString();
+}
+
+void FUnrealMCPNodeSearch::MarkStale(FName PackageName)
+{
+    if (FEntry* Entry = Entries.Find(PackageName))
+    {
+        Entry->bStale = true;
+    }
+}
+
+void FUnrealMCPNodeSearch::RemovePackage(FName PackageName)
+{
+    if (Entries.Remove(PackageName) > 0)
+    {
+        MarkIndexDirty();
+    }
+}
+
+void FUnrealMCPNodeSearch::MarkIndexDirty()
+{
+    bDirty = true;
+    if (!SaveTickerHandle.IsValid())
+    {
+        SaveTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FUnrealMCPNodeSearch::TickSave), NodeSearchSaveDelaySeconds);
+    }
+}
+
+bool FUnrealMCPNodeSearch::TickSave(float DeltaTime)
+{
+    SaveIfDirty();
+    SaveTickerHandle.Reset();
+    return false;
+}
+
+void FUnrealMCPNodeSearch::EnsureLoaded()
+{
+    if (bLoaded)
+    {
+        return;
+    }
+    bLoaded = true;
+
+    FString Contents;
+    TSharedPtr<FJsonObject> IndexObj;
+    if (!FFileHelper::LoadFileToString(Contents, *GetIndexPath()) ||
+        !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Contents), IndexObj) || !IndexObj.IsValid() ||
+        IndexObj->GetIntegerField(TEXT("version")) != NodeSearchIndexVersion)
+    {
+        return;
+    }
+
+    const TSharedPtr<FJsonObject>* BlueprintsObj = nullptr;
+    if (!IndexObj->TryGetObjectField(TEXT("blueprints"), BlueprintsObj))
+    {
+        return;
+    }
+
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Blueprint : (*BlueprintsObj)->Values)
+    {
+        const TSharedPtr<FJsonObject>* BlueprintObj = nullptr;
+        if (!Blueprint.Value->TryGetObject(BlueprintObj))
+        {
+            continue;
+        }
+
+        FEntry& Entry = Entries.Add(FName(*Blueprint.Key));
+        Entry.SavedHash = (*BlueprintObj)->GetStringField(TEXT("hash"));
+        for (const TSharedPtr<FJsonValue>& NodeValue : (*BlueprintObj)->GetArrayField(TEXT("nodes")))
+        {
+            const TArray<TSharedPtr<FJsonValue>>& Fields = NodeValue->AsArray();
+            if (Fields.Num() != 8)
+            {
+                continue;
+            }
+
+            FNodeRecord& Record = Entry.Nodes.AddDefaulted_GetRef();
+            Record.Graph = Fields[0]->AsString();
+            Record.NodeGuid = Fields[1]->AsString();
+            Record.NodeClass = Fields[2]->AsString();
+            Record.Title = Fields[3]->AsString();
+            Record.Function = Fields[4]->AsString();
+            Record.Variable = Fields[5]->AsString();
+            Record.Event = Fields[6]->AsString();
+            Record.Comment = Fields[7]->AsString();
+        }
+        BuildLookup(Entry);
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("UnrealMCP: loaded node search records for %d blueprints"), Entries.Num());
+}
+
+void FUnrealMCPNodeSearch::SaveIfDirty()
+{
+    if (!bDirty)
+    {
+        return;
+    }
+    bDirty = false;
+
+    // Records read from unsaved edits have no hash to check against later, so they stay in memory only
+    TSharedPtr<FJsonObject> BlueprintsObj = MakeShared<FJsonObject>();
+    for (const TPair<FName, FEntry>& Entry : Entries)
+    {
+        if (Entry.Value.SavedHash.IsEmpty())
+        {
+            continue;
+        }
+
+        TArray<TSharedPtr<FJsonValue>> NodesJson;
+        NodesJson.Reserve(Entry.Value.Nodes.Num());
+        for (const FNodeRecord& Record : Entry.Value.Nodes)
+        {
+            TArray<TSharedPtr<FJsonValue>> Fields;
+            for (const FString* Field : { &Record.Graph, &Record.NodeGuid, &Record.NodeClass, &Record.Title, &Record.Function, &Record.Variable, &Record.Event, &Record.Comment })
+            {
+                Fields.Add(MakeShared<FJsonValueString>(*Field));
+            }
+            NodesJson.Add(MakeShared<FJsonValueArray>(Fields));
+        }
+
+        TSharedPtr<FJsonObject> BlueprintObj = MakeShared<FJsonObject>();
+        BlueprintObj->SetStringField(TEXT("hash"), Entry.Value.SavedHash);
+        BlueprintObj->SetArrayField(TEXT("nodes"), NodesJson);
+        BlueprintsObj->SetObjectField(Entry.Key.ToString(), BlueprintObj);
+    }
+
+    TSharedPtr<FJsonObject> IndexObj = MakeShared<FJsonObject>();
+    IndexObj->SetNumberField(TEXT("version"), NodeSearchIndexVersion);
+    IndexObj->SetObjectField(TEXT("blueprints"), BlueprintsObj);
+
+    FString Contents;
+    FJsonSerializer::Serialize(IndexObj.ToSharedRef(), TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Contents));
+    FFileHelper::SaveStringToFile(Contents, *GetIndexPath());
+}
+
+FString FUnrealMCPNodeSearch::GetIndexPath()
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealMCP"), TEXT("NodeSearchIndex.json"));
+}
@@ -0,0 +1,415 @@
+#include "Commands/UnrealMCPPerformanceAudit.h"
+#include "Commands/UnrealMCPCompileQueue.h"
+#include "Engine/Blueprint.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "Engine/SCS_Node.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_DynamicCast.h"
+#include "K2Node_Event.h"
+#include "K2Node_FunctionEntry.h"
+#include "K2Node_Knot.h"
+#include "K2Node_MacroInstance.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "GameFramework/Actor.h"
+#include "Components/ActorComponent.h"
+#include "WidgetBlueprint.h"
+
+// Calls that walk every actor in the world; once per frame they scale with the level, not the blueprint
+static const TSet<FName> ActorIterationFunctions = {
+    TEXT("GetAllActorsOfClass"),
+    TEXT("GetAllActorsOfClassWithTag"),
+    TEXT("GetAllActorsWithTag"),
+    TEXT("GetAllActorsWithInterface"),
+    TEXT("GetActorOfClass"),
+};
+
+void FUnrealMCPPerformanceAudit::Audit(UBlueprint* Blueprint, const FThresholds& Thresholds, TArray<TSharedPtr<FJsonValue>>& OutFindings)
+{
+    if (!Blueprint)
+    {
+        return;
+    }
+
+    // The audit never compiles; class defaults read from a stale generated class are flagged as such
+    if (IsOutOfDate(Blueprint))
+    {
+        OutFindings.Add(MakeShared<FJsonValueObject>(MakeFinding(Blueprint, TEXT("not_compiled"), TEXT("info"),
+            TEXT("Blueprint has edits since its last compile; tick settings reflect the last compiled version"),
+            TEXT("Compile it with compile_blueprint and audit again for exact tick settings"))));
+    }
+
+    AuditTick(Blueprint, Thresholds, OutFindings);
+    AuditWidgetBindings(Blueprint, OutFindings);
+    AuditConstructionScript(Blueprint, Thresholds, OutFindings);
+    AuditComponents(Blueprint, Thresholds, OutFindings);
+}
+
+void FUnrealMCPPerformanceAudit::AuditTick(UBlueprint* Blueprint, const FThresholds& Thresholds, TArray<TSharedPtr<FJsonValue>>& OutFindings)
+{
+    // Actors and components implement ReceiveTick, widgets Tick
+    UK2Node_Event* TickEvent = nullptr;
+    for (UEdGraph* Graph : Blueprint->UbergraphPages)
+    {
+        if (!Graph)
+        {
+            continue;
+        }
+
+        for (UEdGraphNode* Node : Graph->Nodes)
+        {
+            UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node);
+            const FName EventName = EventNode ? EventNode->EventReference.GetMemberName() : NAME_None;
+            if (EventNode && EventNode->IsNodeEnabled() && (EventName == TEXT("ReceiveTick") || EventName == TEXT("Tick")))
+            {
+                TickEvent = EventNode;
+            }
+        }
+    }
+    if (!TickEvent)
+    {
+        return;
+    }
+
+    // The tick settings live on the class default object, as of the last compile
+    const bool bOutOfDate = IsOutOfDate(Blueprint);
+    const UObject* DefaultObject = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
+    const FTickFunction* TickFunction = nullptr;
+    if (const AActor* DefaultActor = Cast<AActor>(DefaultObject))
+    {
+        TickFunction = &DefaultActor->PrimaryActorTick;
+    }
+    else if (const UActorComponent* DefaultComponent = Cast<UActorComponent>(DefaultObject))
+    {
+        TickFunction = &DefaultComponent->PrimaryComponentTick;
+    }
+    if (TickFunction && !TickFunction->bCanEverTick && !bOutOfDate)
+    {
+        return;
+    }
+
+    TArray<UEdGraphNode*> Reached;
+    CollectReachable(Blueprint, TickEvent, Reached);
+
+    TArray<UEdGraphNode*> Casts;
+    TArray<UEdGraphNode*> ActorIterations;
+    int32 NodeCount = 0;
+    for (UEdGraphNode* Node : Reached)
+    {
+        if (Node->IsA<UK2Node_Knot>())
+        {
+            continue;
+        }
+        ++NodeCount;
+
+        if (Node->IsA<UK2Node_DynamicCast>())
+        {
+            Casts.Add(Node);
+        }
+        else if (const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+        {
+            if (ActorIterationFunctions.Contains(CallNode->FunctionReference.GetMemberName()))
+            {
+                ActorIterations.Add(Node);
+            }
+        }
+    }
+
+    if (NodeCount > Thresholds.TickNodes)
+    {
+        TSharedPtr<FJsonObject> Finding = MakeFinding(Blueprint, TEXT("tick_graph"), TEXT("warning"),
+            FString::Printf(TEXT("Tick runs %d nodes every frame"), NodeCount),
+            TEXT("Move the logic to events or timers, or raise the tick interval"));
+        Finding->SetNumberField(TEXT("node_count"), NodeCount);
+        if (TickFunction)
+        {
+            Finding->SetBoolField(TEXT("start_with_tick_enabled"), TickFunction->bStartWithTickEnabled);
+            Finding->SetNumberField(TEXT("tick_interval"), TickFunction->TickInterval);
+        }
+        Finding->SetBoolField(TEXT("tick_settings_out_of_date"), bOutOfDate);
+        Finding->SetArrayField(TEXT("nodes"), { MakeNodeRef(TickEvent) });
+        OutFindings.Add(MakeShared<FJsonValueObject>(Finding));
+    }
+
+    if (Casts.Num() > 0)
+    {
+        TSharedPtr<FJsonObject> Finding = MakeFinding(Blueprint, TEXT("tick_cast"), TEXT("warning"),
+            FString::Printf(TEXT("%d cast(s) run every frame from Tick"), Casts.Num()),
+            TEXT("Cast once in BeginPlay and keep the result in a variable"));
+        TArray<TSharedPtr<FJsonValue>> NodeRefs;
+        for (const UEdGraphNode* Node : Casts)
+        {
+            NodeRefs.Add(MakeNodeRef(Node));
+        }
+        Finding->SetArrayField(TEXT("nodes"), NodeRefs);
+        OutFindings.Add(MakeShared<FJsonValueObject>(Finding));
+    }
+
+    if (ActorIterations.Num() > 0)
+    {
+        TSharedPtr<FJsonObject> Finding = MakeFinding(Blueprint, TEXT("tick_get_all_actors"), TEXT("error"),
+            FString::Printf(TEXT("%d call(s) searching every actor in the level run every frame from Tick"), ActorIterations.Num()),
+            TEXT("Find the actors once in BeginPlay, or have them register themselves, and keep the references in a variable"));
+        TArray<TSharedPtr<FJsonValue>> NodeRefs;
+        for (const UEdGraphNode* Node : ActorIterations)
+        {
+            NodeRefs.Add(MakeNodeRef(Node));
+        }
+        Finding->SetArrayField(TEXT("nodes"), NodeRefs);
+        OutFindings.Add(MakeShared<FJsonValueObject>(Finding));
+    }
+}
+
+void FUnrealMCPPerformanceAudit::AuditWidgetBindings(UBlueprint* Blueprint, TArray<TSharedPtr<FJsonValue>>& OutFindings)
+{
+    const UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(Blueprint);
+    if (!WidgetBlueprint)
+    {
+        return;
+    }
+
+    for (const FDelegateEditorBinding& Binding : WidgetBlueprint->Bindings)
+    {
+        // Function bindings run a graph per frame; property bindings only read a value
+        const bool bFunction = Binding.Kind == EBindingKind::Function;
+        const FString BoundTo = bFunction
+            ? FString::Printf(TEXT("function %s"), *Binding.FunctionName.ToString())
+            : FString::Printf(TEXT("property %s"), *Binding.SourceProperty.ToString());
+        TSharedPtr<FJsonObject> Finding = MakeFinding(Blueprint, TEXT("widget_binding"), bFunction ? TEXT("warning") : TEXT("info"),
+            FString::Printf(TEXT("%s.%s is bound to %s and evaluated every frame"), *Binding.ObjectName, *Binding.PropertyName.ToString(), *BoundTo),
+            TEXT("Set the property from an event when the value changes instead of binding it"));
+        Finding->SetStringField(TEXT("widget_name"), Binding.ObjectName);
+        Finding->SetStringField(TEXT("property_name"), Binding.PropertyName.ToString());
+
+        // A function binding points at a graph; report its entry node and how much it runs
+        TArray<TSharedPtr<FJsonValue>> NodeRefs;
+        if (bFunction)
+        {
+            Finding->SetStringField(TEXT("function_name"), Binding.FunctionName.ToString());
+            for (UEdGraph* Graph : Blueprint->FunctionGraphs)
+            {
+                if (!Graph || Graph->GetFName() != Binding.FunctionName)
+                {
+                    continue;
+                }
+
+                TArray<UK2Node_FunctionEntry*> EntryNodes;
+                Graph->GetNodesOfClass(EntryNodes);
+                if (EntryNodes.Num() > 0)
+                {
+                    TArray<UEdGraphNode*> Reached;
+                    CollectReachable(Blueprint, EntryNodes[0], Reached);
+                    Finding->SetNumberField(TEXT("node_count"), Reached.Num());
+                    NodeRefs.Add(MakeNodeRef(EntryNodes[0]));
+                }
+            }
+        }
+        Finding->SetArrayField(TEXT("nodes"), NodeRefs);
+        OutFindings.Add(MakeShared<FJsonValueObject>(Finding));
+    }
+}
+
+void FUnrealMCPPerformanceAudit::AuditConstructionScript(UBlueprint* Blueprint, const FThresholds& Thresholds, TArray<TSharedPtr<FJsonValue>>& OutFindings)
+{
+    UEdGraph* ConstructionScript = FBlueprintEditorUtils::FindUserConstructionScript(Blueprint);
+    if (!ConstructionScript)
+    {
+        return;
+    }
+
+    TArray<UK2Node_FunctionEntry*> EntryNodes;
+    ConstructionScript->GetNodesOfClass(EntryNodes);
+    if (EntryNodes.Num() == 0)
+    {
+        return;
+    }
+
+    TArray<UEdGraphNode*> Reached;
+    CollectReachable(Blueprint, EntryNodes[0], Reached);
+
+    // Loop macros multiply everything after them by the iteration count
+    TArray<UEdGraphNode*> Loops;
+    int32 NodeCount = 0;
+    for (UEdGraphNode* Node : Reached)
+    {
+        if (Node->IsA<UK2Node_Knot>())
+        {
+            continue;
+        }
+        ++NodeCount;
+
+        const UK2Node_MacroInstance* MacroNode = Cast<UK2Node_MacroInstance>(Node);
+        const UEdGraph* MacroGraph = MacroNode ? MacroNode->GetMacroGraph() : nullptr;
+        if (MacroGraph && MacroGraph->GetName().Contains(TEXT("Loop")))
+        {
+            Loops.Add(Node);
+        }
+    }
+
+    if (NodeCount <= Thresholds.ConstructionScriptNodes && Loops.Num() == 0)
+    {
+        return;
+    }
+
+    TSharedPtr<FJsonObject> Finding = MakeFinding(Blueprint, TEXT("construction_script"), TEXT("warning"),
+        FString::Printf(TEXT("Construction script runs %d nodes and %d loop(s) on every spawn and every edit in the level editor"), NodeCount, Loops.Num()),
+        TEXT("Move work that does not shape the actor to BeginPlay, and bound or precompute loops"));
+    Finding->SetNumberField(TEXT("node_count"), NodeCount);
+
+    TArray<TSharedPtr<FJsonValue>> NodeRefs = { MakeNodeRef(EntryNodes[0]) };
+    for (const UEdGraphNode* Node : Loops)
+    {
+        NodeRefs.Add(MakeNodeRef(Node));
+    }
+    Finding->SetArrayField(TEXT("nodes"), NodeRefs);
+    OutFindings.Add(MakeShared<FJsonValueObject>(Finding));
+}
+
+void FUnrealMCPPerformanceAudit::AuditComponents(UBlueprint* Blueprint, const FThresholds& Thresholds, TArray<TSharedPtr<FJsonValue>>& OutFindings)
+{
+    const USimpleConstructionScript* SCS = Blueprint->SimpleConstructionScript;
+    if (!SCS)
+    {
+        return;
+    }
+
+    const int32 ComponentCount = SCS->GetAllNodes().Num();
+    int32 Depth = 0;
+    TArray<FString> DeepestPath;
+    for (const USCS_Node* RootNode : SCS->GetRootNodes())
+    {
+        TArray<FString> Path;
+        const int32 RootDepth = GetComponentDepth(RootNode, Path);
+        if (RootDepth > Depth)
+        {
+            Depth = RootDepth;
+            DeepestPath = MoveTemp(Path);
+        }
+    }
+
+    if (ComponentCount <= Thresholds.ComponentCount && Depth <= Thresholds.ComponentDepth)
+    {
+        return;
+    }
+
+    TSharedPtr<FJsonObject> Finding = MakeFinding(Blueprint, TEXT("component_hierarchy"), TEXT("warning"),
+        FString::Printf(TEXT("%d components, nested %d deep; each one is created on spawn and moving a parent updates every child"), ComponentCount, Depth),
+        TEXT("Flatten the hierarchy, merge static meshes, or use instanced meshes for repeated parts"));
+    Finding->SetNumberField(TEXT("component_count"), ComponentCount);
+    Finding->SetNumberField(TEXT("depth"), Depth);
+
+    TArray<TSharedPtr<FJsonValue>> PathJson;
+    for (const FString& ComponentName : DeepestPath)
+    {
+        PathJson.Add(MakeShared<FJsonValueString>(ComponentName));
+    }
+    Finding->SetArrayField(TEXT("deepest_path"), PathJson);
+    OutFindings.Add(MakeShared<FJsonValueObject>(Finding));
+}
+
+void FUnrealMCPPerformanceAudit::CollectReachable(UBlueprint* Blueprint, UEdGraphNode* Start, TArray<UEdGraphNode*>& OutNodes)
+{
+    TSet<UEdGraphNode*> Visited;
+    TSet<const UEdGraph*> EnteredGraphs;
+    TArray<UEdGraphNode*> Stack = { Start };
+    while (Stack.Num() > 0)
+    {
+        UEdGraphNode* Node = Stack.Pop(EAllowShrinking::No);
+        bool bAlreadyVisited = false;
+        Visited.Add(Node, &bAlreadyVisited);
+        if (bAlreadyVisited)
+        {
+            continue;
+        }
+        if (Node != Start)
+        {
+            OutNodes.Add(Node);
+        }
+
+        for (const UEdGraphPin* Pin : Node->Pins)
+        {
+            const bool bExec = Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+            for (const UEdGraphPin* Linked : Pin->LinkedTo)
+            {
+                UEdGraphNode* LinkedNode = Linked ? Linked->GetOwningNode() : nullptr;
+                if (!LinkedNode)
+                {
+                    continue;
+                }
+
+                // Follow execution forward, and data back into the pure nodes evaluated for it
+                const UK2Node* LinkedK2Node = Cast<UK2Node>(LinkedNode);
+                if ((bExec && Pin->Direction == EGPD_Output) ||
+                    (!bExec && Pin->Direction == EGPD_Input && LinkedK2Node && LinkedK2Node->IsNodePure()))
+                {
+                    Stack.Add(LinkedNode);
+                }
+            }
+        }
+
+        // Calls into the blueprint's own functions run their graphs too
+        const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node);
+        if (!CallNode || !CallNode->FunctionReference.IsSelfContext())
+        {
+            continue;
+        }
+        for (UEdGraph* Graph : Blueprint->FunctionGraphs)
+        {
+            if (Graph && Graph->GetFName() == CallNode->FunctionReference.GetMemberName() && !EnteredGraphs.Contains(Graph))
+            {
+                EnteredGraphs.Add(Graph);
+                TArray<UK2Node_FunctionEntry*> EntryNodes;
+                Graph->GetNodesOfClass(EntryNodes);
+                Stack.Append(EntryNodes);
+            }
+        }
+    }
+}
+
+bool FUnrealMCPPerformanceAudit::IsOutOfDate(const UBlueprint* Blueprint)
+{
+    return !Blueprint->GeneratedClass || Blueprint->Status == BS_Dirty || Blueprint->Status == BS_Unknown || FUnrealMCPCompileQueue::IsPending(Blueprint);
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPPerformanceAudit::MakeFinding(UBlueprint* Blueprint, const TCHAR* Rule, const TCHAR* Severity, const FString& Message, const FString& Suggestion)
+{
+    TSharedPtr<FJsonObject> Finding = MakeShared<FJsonObject>();
+    Finding->SetStringField(TEXT("blueprint"), Blueprint->GetName());
+    Finding->SetStringField(TEXT("path"), Blueprint->GetPathName());
+    Finding->SetStringField(TEXT("rule"), Rule);
+    Finding->SetStringField(TEXT("severity"), Severity);
+    Finding->SetStringField(TEXT("message"), Message);
+    Finding->SetStringField(TEXT("suggestion"), Suggestion);
+    return Finding;
+}
+
+TSharedPtr<FJsonValue> FUnrealMCPPerformanceAudit::MakeNodeRef(const UEdGraphNode* Node)
+{
+    TSharedPtr<FJsonObject> NodeRef = MakeShared<FJsonObject>();
+    NodeRef->SetStringField(TEXT("graph_name"), Node->GetGraph() ? Node->GetGraph()->GetName() : FString());
+    NodeRef->SetStringField(TEXT("node_id"), Node->NodeGuid.ToString());
+    NodeRef->SetStringField(TEXT("title"), Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
+    return MakeShared<FJsonValueObject>(NodeRef);
+}
+
+int32 FUnrealMCPPerformanceAudit::GetComponentDepth(const USCS_Node* Node, TArray<FString>& OutDeepestPath)
+{
+    OutDeepestPath = { Node->GetVariableName().ToString() };
+
+    TArray<FString> DeepestChildPath;
+    for (const USCS_Node* Child : Node->GetChildNodes())
+    {
+        TArray<FString> ChildPath;
+        GetComponentDepth(Child, ChildPath);
+        if (ChildPath.Num() > DeepestChildPath.Num())
+        {
+            DeepestChildPath = MoveTemp(ChildPath);
+        }
+    }
+
+    OutDeepestPath.Append(DeepestChildPath);
+    return OutDeepestPath.Num();
+}
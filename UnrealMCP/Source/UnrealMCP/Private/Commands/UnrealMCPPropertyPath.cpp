@@ -0,0 +1,264 @@
+#include "Commands/UnrealMCPPropertyPath.h"
+#include "Commands/UnrealMCPCommonUtils.h"
+#include "GameFramework/Actor.h"
+#include "Components/ActorComponent.h"
+#include "UObject/UnrealType.h"
+
+TMap<FObjectKey, TMap<FString, TSharedPtr<const FUnrealMCPPropertyPath>>> FUnrealMCPPropertyPath::Cache;
+
+TSharedPtr<const FUnrealMCPPropertyPath> FUnrealMCPPropertyPath::Compile(UClass* Class, const FString& Path, FString& OutErrorMessage)
+{
+    if (!Class)
+    {
+        OutErrorMessage = TEXT("Invalid class");
+        return nullptr;
+    }
+
+    TMap<FString, TSharedPtr<const FUnrealMCPPropertyPath>>& ClassCache = Cache.FindOrAdd(FObjectKey(Class));
+    if (const TSharedPtr<const FUnrealMCPPropertyPath>* Found = ClassCache.Find(Path))
+    {
+        return *Found;
+    }
+
+    // Failed compiles are not cached so a later blueprint change can make the path valid
+    TSharedPtr<FUnrealMCPPropertyPath> Compiled = MakeShared<FUnrealMCPPropertyPath>();
+    Compiled->Path = Path;
+    if (!Compiled->CompileSegments(Class, OutErrorMessage))
+    {
+        return nullptr;
+    }
+
+    ClassCache.Add(Path, Compiled);
+    return Compiled;
+}
+
+bool FUnrealMCPPropertyPath::Resolve(UObject* Object, const FString& Path, FResolved& OutResolved, FString& OutErrorMessage)
+{
+    if (!Object)
+    {
+        OutErrorMessage = TEXT("Invalid object");
+        return false;
+    }
+
+    TSharedPtr<const FUnrealMCPPropertyPath> Compiled = Compile(Object->GetClass(), Path, OutErrorMessage);
+    return Compiled.IsValid() && Compiled->Resolve(Object, OutResolved, OutErrorMessage);
+}
+
+bool FUnrealMCPPropertyPath::Resolve(UObject* Object, FResolved& OutResolved, FString& OutErrorMessage) const
+{
+    if (!Object)
+    {
+        OutErrorMessage = TEXT("Invalid object");
+        return false;
+    }
+
+    if (!ComponentName.IsNone())
+    {
+        AActor* Actor = Cast<AActor>(Object);
+        if (!Actor)
+        {
+            OutErrorMessage = FString::Printf(TEXT("'%s' is not an actor, cannot look up component '%s'"), *Object->GetName(), *ComponentName.ToString());
+            return false;
+        }
+
+        // A class name (e.g. "StaticMeshComponent") matches the first component of that class or a
+        // subclass, as FindComponentByClass does; anything else is a component instance name
+        UActorComponent* Component = nullptr;
+        if (UClass* Class = ComponentClass.Get())
+        {
+            for (UActorComponent* Candidate : Actor->GetComponents())
+            {
+                if (Candidate && Candidate->IsA(Class))
+                {
+                    Component = Candidate;
+                    break;
+                }
+            }
+        }
+        if (!Component)
+        {
+            Component = FUnrealMCPCommonUtils::FindComponentByName(Actor, ComponentName);
+        }
+
+        if (!Component)
+        {
+            OutErrorMessage = FString::Printf(TEXT("Component '%s' not found on actor '%s'"), *ComponentName.ToString(), *Actor->GetName());
+            return false;
+        }
+        return FUnrealMCPPropertyPath::Resolve(Component, SubPath, OutResolved, OutErrorMessage);
+    }
+
+    void* Container = Object;
+    FProperty* LeafProperty = nullptr;
+    void* ValuePtr = nullptr;
+    for (const FSegment& Segment : Segments)
+    {
+        if (Segment.bDynamicArray)
+        {
+            FArrayProperty* ArrayProperty = CastFieldChecked<FArrayProperty>(Segment.Property);
+            FScriptArrayHelper ArrayHelper(ArrayProperty, ArrayProperty->ContainerPtrToValuePtr<void>(Container));
+            if (!ArrayHelper.IsValidIndex(Segment.ArrayIndex))
+            {
+                OutErrorMessage = FString::Printf(TEXT("Index %d out of range for '%s' (size %d)"),
+                    Segment.ArrayIndex, *Segment.Property->GetName(), ArrayHelper.Num());
+                return false;
+            }
+            ValuePtr = ArrayHelper.GetRawPtr(Segment.ArrayIndex);
+            LeafProperty = ArrayProperty->Inner;
+        }
+        else
+        {
+            ValuePtr = Segment.Property->ContainerPtrToValuePtr<void>(Container, FMath::Max(0, Segment.ArrayIndex));
+            LeafProperty = Segment.Property;
+        }
+        Container = ValuePtr;
+    }
+
+    if (!SubPath.IsEmpty())
+    {
+        FObjectPropertyBase* ObjectProperty = CastFieldChecked<FObjectPropertyBase>(LeafProperty);
+        UObject* Referenced = ObjectProperty->GetObjectPropertyValue(ValuePtr);
+        if (!Referenced)
+        {
+            OutErrorMessage = FString::Printf(TEXT("'%s' is None in path '%s'"), *LeafProperty->GetName(), *Path);
+            return false;
+        }
+        return FUnrealMCPPropertyPath::Resolve(Referenced, SubPath, OutResolved, OutErrorMessage);
+    }
+
+    OutResolved.Owner = Object;
+    OutResolved.MemberProperty = Segments[0].Property;
+    OutResolved.Property = LeafProperty;
+    OutResolved.ValuePtr = ValuePtr;
+    return true;
+}
+
+void FUnrealMCPPropertyPath::ClearCache()
+{
+    Cache.Reset();
+}
+
+bool FUnrealMCPPropertyPath::CompileSegments(UClass* Class, FString& OutErrorMessage)
+{
+    TArray<FString> Tokens;
+    Path.ParseIntoArray(Tokens, TEXT("."), false);
+    if (Tokens.Num() == 0)
+    {
+        OutErrorMessage = TEXT("Empty property path");
+        return false;
+    }
+
+    auto JoinRemaining = [&Tokens](int32 First)
+    {
+        FString Remaining;
+        for (int32 Index = First; Index < Tokens.Num(); ++Index)
+        {
+            Remaining += (Index > First ? TEXT(".") : TEXT("")) + Tokens[Index];
+        }
+        return Remaining;
+    };
+
+    UStruct* CurrentStruct = Class;
+    for (int32 TokenIndex = 0; TokenIndex < Tokens.Num(); ++TokenIndex)
+    {
+        // Split "Name[Index]"
+        FString Name = Tokens[TokenIndex];
+        int32 ArrayIndex = INDEX_NONE;
+        int32 BracketPos = INDEX_NONE;
+        if (Name.FindChar(TEXT('['), BracketPos))
+        {
+            const FString IndexString = Name.Mid(BracketPos + 1, Name.Len() - BracketPos - 2);
+            if (!Name.EndsWith(TEXT("]")) || !IndexString.IsNumeric() || IndexString.Contains(TEXT("-")))
+            {
+                OutErrorMessage = FString::Printf(TEXT("Invalid array index in '%s'"), *Tokens[TokenIndex]);
+                return false;
+            }
+            ArrayIndex = FCString::Atoi(*IndexString);
+            Name.LeftInline(BracketPos);
+        }
+
+        if (Name.IsEmpty())
+        {
+            OutErrorMessage = FString::Printf(TEXT("Invalid property path: %s"), *Path);
+            return false;
+        }
+
+        FProperty* Property = CurrentStruct->FindPropertyByName(FName(*Name));
+        if (!Property)
+        {
+            // User defined structs mangle their member names, so also match the authored name
+            for (TFieldIterator<FProperty> It(CurrentStruct); It; ++It)
+            {
+                if (It->GetAuthoredName() == Name)
+                {
+                    Property = *It;
+                    break;
+                }
+            }
+        }
+
+        if (!Property)
+        {
+            if (TokenIndex == 0 && ArrayIndex == INDEX_NONE && Tokens.Num() > 1 && Class->IsChildOf(AActor::StaticClass()))
+            {
+                ComponentName = FName(*Name);
+                SubPath = JoinRemaining(1);
+
+                UClass* NamedClass = FindFirstObject<UClass>(*Name, EFindFirstObjectOptions::NativeFirst);
+                if (NamedClass && NamedClass->IsChildOf(UActorComponent::StaticClass()))
+                {
+                    ComponentClass = NamedClass;
+                }
+                return true;
+            }
+
+            OutErrorMessage = FString::Printf(TEXT("Property '%s' not found on %s"), *Name, *CurrentStruct->GetName());
+            return false;
+        }
+
+        FSegment& Segment = Segments.AddDefaulted_GetRef();
+        Segment.Property = Property;
+        Segment.ArrayIndex = ArrayIndex;
+
+        FProperty* ValueProperty = Property;
+        if (ArrayIndex != INDEX_NONE)
+        {
+            if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+            {
+                Segment.bDynamicArray = true;
+                ValueProperty = ArrayProperty->Inner;
+            }
+            else if (ArrayIndex >= Property->ArrayDim)
+            {
+                OutErrorMessage = Property->ArrayDim > 1
+                    ? FString::Printf(TEXT("Index %d out of range for '%s' (size %d)"), ArrayIndex, *Name, Property->ArrayDim)
+                    : FString::Printf(TEXT("Property '%s' is not an array"), *Name);
+                return false;
+            }
+        }
+
+        if (TokenIndex == Tokens.Num() - 1)
+        {
+            break;
+        }
+
+        if (FStructProperty* StructProperty = CastField<FStructProperty>(ValueProperty))
+        {
+            CurrentStruct = StructProperty->Struct;
+        }
+        else if (CastField<FObjectPropertyBase>(ValueProperty))
+        {
+            // The referenced object's class is only known at resolve time
+            SubPath = JoinRemaining(TokenIndex + 1);
+            return true;
+        }
+        else
+        {
+            OutErrorMessage = FString::Printf(TEXT("Cannot access '%s' inside %s '%s'"),
+                *Tokens[TokenIndex + 1], *ValueProperty->GetClass()->GetName(), *Name);
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,401 @@
+#include "Commands/UnrealMCPSnapshotCommands.h"
+#include "Commands/UnrealMCPCommonUtils.h"
+#include "UnrealMCPLevelSnapshot.h"
+#include "UnrealMCPJsonWriter.h"
+#include "Editor.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "Misc/Base64.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+// Oldest snapshots are dropped once this many are held
+const int32 MaxHeldSnapshots = 32;
+
+FUnrealMCPSnapshotCommands::FUnrealMCPSnapshotCommands()
+    : NextSnapshotId(1)
+{
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPSnapshotCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    if (CommandType == TEXT("export_level_snapshot"))
+    {
+        return HandleExportLevelSnapshot(Params);
+    }
+    else if (CommandType == TEXT("create_snapshot"))
+    {
+        return HandleCreateSnapshot(Params);
+    }
+    else if (CommandType == TEXT("diff_snapshots"))
+    {
+        return HandleDiffSnapshots(Params);
+    }
+    else if (CommandType == TEXT("delete_snapshot"))
+    {
+        return HandleDeleteSnapshot(Params);
+    }
+
+    return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown snapshot command: %s"), *CommandType));
+}
+
+bool FUnrealMCPSnapshotCommands::IsStreamingCommand(const FString& CommandType)
+{
+    return CommandType == TEXT("export_level_snapshot");
+}
+
+bool FUnrealMCPSnapshotCommands::StreamCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, FUnrealMCPJsonWriter& Writer, FString& OutErrorMessage)
+{
+    if (CommandType == TEXT("export_level_snapshot"))
+    {
+        return StreamExportLevelSnapshot(Params, Writer, OutErrorMessage);
+    }
+
+    OutErrorMessage = FString::Printf(TEXT("Command does not support streaming: %s"), *CommandType);
+    return false;
+}
+
+bool FUnrealMCPSnapshotCommands::ExportLevelSnapshot(const TSharedPtr<FJsonObject>& Params, FLevelSnapshotExport& OutExport, FString& OutErrorMessage)
+{
+    // Without a path the snapshot is returned inline
+    FString FilePath;
+    Params->TryGetStringField(TEXT("path"), FilePath);
+
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        OutErrorMessage = TEXT("Failed to get editor world");
+        return false;
+    }
+
+    FUnrealMCPLevelSnapshot Snapshot;
+    CaptureLevelSnapshot(World, Snapshot);
+    Snapshot.Write(OutExport.Bytes);
+
+    OutExport.LevelName = Snapshot.LevelName;
+    OutExport.ActorCount = Snapshot.Actors.Num();
+    OutExport.StringCount = Snapshot.Strings.Num();
+
+    if (!FilePath.IsEmpty())
+    {
+        // Relative paths are resolved against the project's Saved directory
+        if (FPaths::IsRelative(FilePath))
+        {
+            FilePath = FPaths::Combine(FPaths::ProjectSavedDir(), FilePath);
+        }
+        FilePath = FPaths::ConvertRelativePathToFull(FilePath);
+
+        if (!FFileHelper::SaveArrayToFile(OutExport.Bytes, *FilePath))
+        {
+            OutErrorMessage = FString::Printf(TEXT("Failed to write snapshot to: %s"), *FilePath);
+            return false;
+        }
+        OutExport.FilePath = FilePath;
+    }
+    return true;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPSnapshotCommands::HandleExportLevelSnapshot(const TSharedPtr<FJsonObject>& Params)
+{
+    FLevelSnapshotExport Export;
+    FString ErrorMessage;
+    if (!ExportLevelSnapshot(Params, Export, ErrorMessage))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("level"), Export.LevelName);
+    ResultObj->SetNumberField(TEXT("version"), FUnrealMCPLevelSnapshot::Version);
+    ResultObj->SetNumberField(TEXT("actor_count"), Export.ActorCount);
+    ResultObj->SetNumberField(TEXT("string_count"), Export.StringCount);
+    ResultObj->SetNumberField(TEXT("byte_size"), Export.Bytes.Num());
+
+    if (!Export.FilePath.IsEmpty())
+    {
+        ResultObj->SetStringField(TEXT("path"), Export.FilePath);
+    }
+    else
+    {
+        // A DOM result always ends up as text, so the bytes go out as base64
+        ResultObj->SetStringField(TEXT("encoding"), TEXT("base64"));
+        ResultObj->SetStringField(TEXT("data"), FBase64::Encode(Export.Bytes));
+    }
+
+    return ResultObj;
+}
+
+bool FUnrealMCPSnapshotCommands::StreamExportLevelSnapshot(const TSharedPtr<FJsonObject>& Params, FUnrealMCPJsonWriter& Writer, FString& OutErrorMessage)
+{
+    FLevelSnapshotExport Export;
+    if (!ExportLevelSnapshot(Params, Export, OutErrorMessage))
+    {
+        return false;
+    }
+
+    Writer.BeginObject();
+    Writer.WriteStringField(TEXT("level"), Export.LevelName);
+    Writer.WriteKey(TEXT("version"));
+    Writer.WriteInt(FUnrealMCPLevelSnapshot::Version);
+    Writer.WriteKey(TEXT("actor_count"));
+    Writer.WriteInt(Export.ActorCount);
+    Writer.WriteKey(TEXT("string_count"));
+    Writer.WriteInt(Export.StringCount);
+    Writer.WriteKey(TEXT("byte_size"));
+    Writer.WriteInt(Export.Bytes.Num());
+
+    if (!Export.FilePath.IsEmpty())
+    {
+        Writer.WriteStringField(TEXT("path"), Export.FilePath);
+    }
+    else
+    {
+        // MessagePack connections get the bytes as bin; JSON ones still need base64
+        Writer.WriteStringField(TEXT("encoding"), Writer.WritesRawBinary() ? TEXT("binary") : TEXT("base64"));
+        Writer.WriteKey(TEXT("data"));
+        Writer.WriteBinary(Export.Bytes);
+    }
+    Writer.EndObject();
+    return true;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPSnapshotCommands::HandleCreateSnapshot(const TSharedPtr<FJsonObject>& Params)
+{
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
+    TSharedPtr<FUnrealMCPLevelSnapshot> Snapshot = MakeShared<FUnrealMCPLevelSnapshot>();
+    CaptureLevelSnapshot(World, *Snapshot);
+
+    const FString Handle = FString::Printf(TEXT("snapshot_%d"), NextSnapshotId++);
+    Snapshots.Add(Handle, Snapshot);
+    SnapshotOrder.Add(Handle);
+
+    while (SnapshotOrder.Num() > MaxHeldSnapshots)
+    {
+        Snapshots.Remove(SnapshotOrder[0]);
+        SnapshotOrder.RemoveAt(0);
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("handle"), Handle);
+    ResultObj->SetStringField(TEXT("level"), Snapshot->LevelName);
+    ResultObj->SetNumberField(TEXT("actor_count"), Snapshot->Actors.Num());
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPSnapshotCommands::HandleDiffSnapshots(const TSharedPtr<FJsonObject>& Params)
+{
+    FString HandleA;
+    FString HandleB;
+    if (!Params->TryGetStringField(TEXT("a"), HandleA) || !Params->TryGetStringField(TEXT("b"), HandleB))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'a' or 'b' snapshot handle"));
+    }
+
+    const TSharedPtr<FUnrealMCPLevelSnapshot>* FoundA = Snapshots.Find(HandleA);
+    if (!FoundA)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Snapshot not found: %s"), *HandleA));
+    }
+    const TSharedPtr<FUnrealMCPLevelSnapshot>* FoundB = Snapshots.Find(HandleB);
+    if (!FoundB)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Snapshot not found: %s"), *HandleB));
+    }
+
+    // Differences at or below this are treated as unchanged
+    double Tolerance = 1e-3;
+    Params->TryGetNumberField(TEXT("tolerance"), Tolerance);
+    const float FloatTolerance = static_cast<float>(Tolerance);
+
+    const FUnrealMCPLevelSnapshot& A = **FoundA;
+    const FUnrealMCPLevelSnapshot& B = **FoundB;
+
+    // Index B by actor name once; each A actor is then matched with one lookup
+    TMap<FString, int32> IndexInB;
+    IndexInB.Reserve(B.Actors.Num());
+    for (int32 Index = 0; Index < B.Actors.Num(); ++Index)
+    {
+        IndexInB.Add(B.GetString(B.Actors[Index].NameIndex), Index);
+    }
+
+    TBitArray<> MatchedInB(false, B.Actors.Num());
+    TArray<TSharedPtr<FJsonValue>> Removed;
+    TArray<TSharedPtr<FJsonValue>> Modified;
+
+    auto VectorToJson = [](const FVector3f& Vector)
+    {
+        TArray<TSharedPtr<FJsonValue>> Array;
+        Array.Add(MakeShared<FJsonValueNumber>(Vector.X));
+        Array.Add(MakeShared<FJsonValueNumber>(Vector.Y));
+        Array.Add(MakeShared<FJsonValueNumber>(Vector.Z));
+        return Array;
+    };
+
+    for (const FUnrealMCPSnapshotActor& ActorA : A.Actors)
+    {
+        const FString& Name = A.GetString(ActorA.NameIndex);
+        const int32* FoundIndex = IndexInB.Find(Name);
+        if (!FoundIndex)
+        {
+            Removed.Add(MakeShared<FJsonValueString>(Name));
+            continue;
+        }
+
+        MatchedInB[*FoundIndex] = true;
+        const FUnrealMCPSnapshotActor& ActorB = B.Actors[*FoundIndex];
+
+        // Only fields that changed are reported, with their new values
+        TSharedPtr<FJsonObject> Changes = MakeShared<FJsonObject>();
+        if (!ActorA.Location.Equals(ActorB.Location, FloatTolerance))
+        {
+            Changes->SetArrayField(TEXT("location"), VectorToJson(ActorB.Location));
+        }
+        if (!ActorA.Rotation.Equals(ActorB.Rotation, FloatTolerance))
+        {
+            Changes->SetArrayField(TEXT("rotation"), VectorToJson(FVector3f(ActorB.Rotation.Pitch, ActorB.Rotation.Yaw, ActorB.Rotation.Roll)));
+        }
+        if (!ActorA.Scale.Equals(ActorB.Scale, FloatTolerance))
+        {
+            Changes->SetArrayField(TEXT("scale"), VectorToJson(ActorB.Scale));
+        }
+        if (!A.GetString(ActorA.LabelIndex).Equals(B.GetString(ActorB.LabelIndex), ESearchCase::CaseSensitive))
+        {
+            Changes->SetStringField(TEXT("label"), B.GetString(ActorB.LabelIndex));
+        }
+        if (A.GetString(ActorA.ClassIndex) != B.GetString(ActorB.ClassIndex))
+        {
+            Changes->SetStringField(TEXT("class"), B.GetString(ActorB.ClassIndex));
+        }
+        if (A.GetString(ActorA.FolderIndex) != B.GetString(ActorB.FolderIndex))
+        {
+            Changes->SetStringField(TEXT("folder"), B.GetString(ActorB.FolderIndex));
+        }
+        if (A.GetString(ActorA.ParentIndex) != B.GetString(ActorB.ParentIndex))
+        {
+            Changes->SetStringField(TEXT("parent"), B.GetString(ActorB.ParentIndex));
+        }
+
+        if (Changes->Values.Num() > 0)
+        {
+            TSharedPtr<FJsonObject> ModifiedObj = MakeShared<FJsonObject>();
+            ModifiedObj->SetStringField(TEXT("name"), Name);
+            ModifiedObj->SetObjectField(TEXT("changes"), Changes);
+            Modified.Add(MakeShared<FJsonValueObject>(ModifiedObj));
+        }
+    }
+
+    TArray<TSharedPtr<FJsonValue>> Added;
+    for (int32 Index = 0; Index < B.Actors.Num(); ++Index)
+    {
+        if (!MatchedInB[Index])
+        {
+            Added.Add(MakeShared<FJsonValueObject>(SnapshotActorToJson(B, Index)));
+        }
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("a"), HandleA);
+    ResultObj->SetStringField(TEXT("b"), HandleB);
+    ResultObj->SetArrayField(TEXT("added"), Added);
+    ResultObj->SetArrayField(TEXT("removed"), Removed);
+    ResultObj->SetArrayField(TEXT("modified"), Modified);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPSnapshotCommands::HandleDeleteSnapshot(const TSharedPtr<FJsonObject>& Params)
+{
+    FString Handle;
+    if (!Params->TryGetStringField(TEXT("handle"), Handle))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'handle' parameter"));
+    }
+
+    if (Snapshots.Remove(Handle) == 0)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Snapshot not found: %s"), *Handle));
+    }
+    SnapshotOrder.Remove(Handle);
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("handle"), Handle);
+    ResultObj->SetBoolField(TEXT("deleted"), true);
+    return ResultObj;
+}
+
+void FUnrealMCPSnapshotCommands::CaptureLevelSnapshot(UWorld* World, FUnrealMCPLevelSnapshot& OutSnapshot)
+{
+    OutSnapshot.LevelName = World->GetMapName();
+
+    for (TActorIterator<AActor> It(World); It; ++It)
+    {
+        AActor* Actor = *It;
+        if (!Actor)
+        {
+            continue;
+        }
+
+        FUnrealMCPSnapshotActor& Record = OutSnapshot.Actors.AddDefaulted_GetRef();
+        Record.NameIndex = OutSnapshot.AddString(Actor->GetName());
+        Record.LabelIndex = OutSnapshot.AddString(Actor->GetActorLabel());
+        Record.ClassIndex = OutSnapshot.AddString(Actor->GetClass()->GetPathName());
+
+        const FName FolderPath = Actor->GetFolderPath();
+        if (!FolderPath.IsNone())
+        {
+            Record.FolderIndex = OutSnapshot.AddString(FolderPath.ToString());
+        }
+
+        if (AActor* Parent = Actor->GetAttachParentActor())
+        {
+            Record.ParentIndex = OutSnapshot.AddString(Parent->GetName());
+        }
+
+        const FTransform& Transform = Actor->GetActorTransform();
+        Record.Location = FVector3f(Transform.GetLocation());
+        Record.Rotation = FRotator3f(Transform.Rotator());
+        Record.Scale = FVector3f(Transform.GetScale3D());
+    }
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPSnapshotCommands::SnapshotActorToJson(const FUnrealMCPLevelSnapshot& Snapshot, int32 ActorIndex)
+{
+    const FUnrealMCPSnapshotActor& Actor = Snapshot.Actors[ActorIndex];
+
+    TSharedPtr<FJsonObject> ActorObj = MakeShared<FJsonObject>();
+    ActorObj->SetStringField(TEXT("name"), Snapshot.GetString(Actor.NameIndex));
+    ActorObj->SetStringField(TEXT("label"), Snapshot.GetString(Actor.LabelIndex));
+    ActorObj->SetStringField(TEXT("class"), Snapshot.GetString(Actor.ClassIndex));
+    if (Actor.FolderIndex != INDEX_NONE)
+    {
+        ActorObj->SetStringField(TEXT("folder"), Snapshot.GetString(Actor.FolderIndex));
+    }
+    if (Actor.ParentIndex != INDEX_NONE)
+    {
+        ActorObj->SetStringField(TEXT("parent"), Snapshot.GetString(Actor.ParentIndex));
+    }
+
+    TArray<TSharedPtr<FJsonValue>> LocationArray;
+    LocationArray.Add(MakeShared<FJsonValueNumber>(Actor.Location.X));
+    LocationArray.Add(MakeShared<FJsonValueNumber>(Actor.Location.Y));
+    LocationArray.Add(MakeShared<FJsonValueNumber>(Actor.Location.Z));
+    ActorObj->SetArrayField(TEXT("location"), LocationArray);
+
+    TArray<TSharedPtr<FJsonValue>> RotationArray;
+    RotationArray.Add(MakeShared<FJsonValueNumber>(Actor.Rotation.Pitch));
+    RotationArray.Add(MakeShared<FJsonValueNumber>(Actor.Rotation.Yaw));
+    RotationArray.Add(MakeShared<FJsonValueNumber>(Actor.Rotation.Roll));
+    ActorObj->SetArrayField(TEXT("rotation"), RotationArray);
+
+    TArray<TSharedPtr<FJsonValue>> ScaleArray;
+    ScaleArray.Add(MakeShared<FJsonValueNumber>(Actor.Scale.X));
+    ScaleArray.Add(MakeShared<FJsonValueNumber>(Actor.Scale.Y));
+    ScaleArray.Add(MakeShared<FJsonValueNumber>(Actor.Scale.Z));
+    ActorObj->SetArrayField(TEXT("scale"), ScaleArray);
+
+    return ActorObj;
+}
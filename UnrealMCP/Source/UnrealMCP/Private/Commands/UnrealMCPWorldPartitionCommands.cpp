@@ -0,0 +1,262 @@
+#include "Commands/UnrealMCPWorldPartitionCommands.h"
+#include "Commands/UnrealMCPCommonUtils.h"
+#include "Editor.h"
+#include "GameFramework/Actor.h"
+#include "WorldPartition/WorldPartition.h"
+#include "WorldPartition/WorldPartitionHelpers.h"
+#include "WorldPartition/WorldPartitionActorDescInstance.h"
+#include "WorldPartition/WorldPartitionEditorLoaderAdapter.h"
+#include "WorldPartition/LoaderAdapter/LoaderAdapterShape.h"
+
+FUnrealMCPWorldPartitionCommands::FUnrealMCPWorldPartitionCommands()
+    : NextRegionId(1)
+{
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPWorldPartitionCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    if (CommandType == TEXT("query_world_partition_actors"))
+    {
+        return HandleQueryActorDescs(Params);
+    }
+    else if (CommandType == TEXT("load_world_partition_region"))
+    {
+        return HandleLoadRegion(Params);
+    }
+    else if (CommandType == TEXT("unload_world_partition_region"))
+    {
+        return HandleUnloadRegion(Params);
+    }
+
+    return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown world partition command: %s"), *CommandType));
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPWorldPartitionCommands::HandleQueryActorDescs(const TSharedPtr<FJsonObject>& Params)
+{
+    FString ErrorMessage;
+    UWorldPartition* WorldPartition = GetEditorWorldPartition(ErrorMessage);
+    if (!WorldPartition)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+    }
+
+    // Optional filters
+    FString ClassName;
+    Params->TryGetStringField(TEXT("class"), ClassName);
+
+    FString NamePattern;
+    Params->TryGetStringField(TEXT("name_pattern"), NamePattern);
+
+    FString DataLayerString;
+    Params->TryGetStringField(TEXT("data_layer"), DataLayerString);
+    const FName DataLayer = DataLayerString.IsEmpty() ? NAME_None : FName(*DataLayerString);
+
+    const bool bUseBox = Params->HasField(TEXT("box_min")) && Params->HasField(TEXT("box_max"));
+    FBox Box(ForceInit);
+    if (bUseBox)
+    {
+        const FVector BoxMin = FUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("box_min"));
+        const FVector BoxMax = FUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("box_max"));
+        Box = FBox(BoxMin.ComponentMin(BoxMax), BoxMin.ComponentMax(BoxMax));
+    }
+
+    int32 Offset = 0;
+    int32 Limit = 1000;
+    Params->TryGetNumberField(TEXT("offset"), Offset);
+    Params->TryGetNumberField(TEXT("limit"), Limit);
+
+    // Class matches are decided once per native class
+    TMap<UClass*, bool> ClassMatches;
+    auto MatchesClass = [&ClassMatches, &ClassName](const FWorldPartitionActorDescInstance* ActorDesc)
+    {
+        if (ActorDesc->GetBaseClass().IsValid() && ActorDesc->GetBaseClass().GetAssetName().ToString() == ClassName)
+        {
+            return true;
+        }
+
+        UClass* NativeClass = ActorDesc->GetActorNativeClass();
+        if (const bool* Cached = ClassMatches.Find(NativeClass))
+        {
+            return *Cached;
+        }
+
+        bool bMatches = false;
+        for (UClass* Class = NativeClass; Class && !bMatches; Class = Class->GetSuperClass())
+        {
+            bMatches = Class->GetName() == ClassName;
+        }
+        ClassMatches.Add(NativeClass, bMatches);
+        return bMatches;
+    };
+
+    int32 MatchCount = 0;
+    TArray<TSharedPtr<FJsonValue>> ActorArray;
+    FWorldPartitionHelpers::ForEachActorDescInstance(WorldPartition, AActor::StaticClass(), [&](const FWorldPartitionActorDescInstance* ActorDesc)
+    {
+        if (!ClassName.IsEmpty() && !MatchesClass(ActorDesc))
+        {
+            return true;
+        }
+
+        const FString Label = ActorDesc->GetActorLabel().ToString();
+        const FString Name = ActorDesc->GetActorName().ToString();
+        if (!NamePattern.IsEmpty() && !Label.MatchesWildcard(NamePattern) && !Name.MatchesWildcard(NamePattern))
+        {
+            return true;
+        }
+
+        const FBox Bounds = ActorDesc->GetEditorBounds();
+        if (bUseBox && !Box.Intersect(Bounds))
+        {
+            return true;
+        }
+
+        TArray<TSharedPtr<FJsonValue>> DataLayerArray;
+        bool bInDataLayer = DataLayer.IsNone();
+        for (const FName& DataLayerName : ActorDesc->GetDataLayerInstanceNames().ToArray())
+        {
+            bInDataLayer |= DataLayerName == DataLayer;
+            DataLayerArray.Add(MakeShared<FJsonValueString>(DataLayerName.ToString()));
+        }
+        if (!bInDataLayer)
+        {
+            return true;
+        }
+
+        // Only the requested page is serialized, but every match is counted
+        const int32 MatchIndex = MatchCount++;
+        if (MatchIndex < Offset || ActorArray.Num() >= Limit)
+        {
+            return true;
+        }
+
+        TSharedPtr<FJsonObject> ActorObj = MakeShared<FJsonObject>();
+        ActorObj->SetStringField(TEXT("guid"), ActorDesc->GetGuid().ToString(EGuidFormats::DigitsWithHyphens));
+        ActorObj->SetStringField(TEXT("name"), Name);
+        ActorObj->SetStringField(TEXT("label"), Label);
+        ActorObj->SetStringField(TEXT("class"), ActorDesc->GetActorNativeClass() ? ActorDesc->GetActorNativeClass()->GetName() : FString());
+        if (ActorDesc->GetBaseClass().IsValid())
+        {
+            ActorObj->SetStringField(TEXT("base_class"), ActorDesc->GetBaseClass().ToString());
+        }
+        ActorObj->SetStringField(TEXT("package"), ActorDesc->GetActorPackage().ToString());
+        ActorObj->SetBoolField(TEXT("loaded"), ActorDesc->IsLoaded());
+        ActorObj->SetBoolField(TEXT("spatially_loaded"), ActorDesc->GetIsSpatiallyLoaded());
+        ActorObj->SetArrayField(TEXT("data_layers"), DataLayerArray);
+
+        TArray<TSharedPtr<FJsonValue>> MinArray;
+        MinArray.Add(MakeShared<FJsonValueNumber>(Bounds.Min.X));
+        MinArray.Add(MakeShared<FJsonValueNumber>(Bounds.Min.Y));
+        MinArray.Add(MakeShared<FJsonValueNumber>(Bounds.Min.Z));
+        ActorObj->SetArrayField(TEXT("bounds_min"), MinArray);
+
+        TArray<TSharedPtr<FJsonValue>> MaxArray;
+        MaxArray.Add(MakeShared<FJsonValueNumber>(Bounds.Max.X));
+        MaxArray.Add(MakeShared<FJsonValueNumber>(Bounds.Max.Y));
+        MaxArray.Add(MakeShared<FJsonValueNumber>(Bounds.Max.Z));
+        ActorObj->SetArrayField(TEXT("bounds_max"), MaxArray);
+
+        ActorArray.Add(MakeShared<FJsonValueObject>(ActorObj));
+        return true;
+    });
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetNumberField(TEXT("total"), MatchCount);
+    ResultObj->SetNumberField(TEXT("offset"), Offset);
+    ResultObj->SetArrayField(TEXT("actors"), ActorArray);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPWorldPartitionCommands::HandleLoadRegion(const TSharedPtr<FJsonObject>& Params)
+{
+    if (!Params->HasField(TEXT("box_min")) || !Params->HasField(TEXT("box_max")))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'box_min' or 'box_max' parameter"));
+    }
+
+    FString ErrorMessage;
+    UWorldPartition* WorldPartition = GetEditorWorldPartition(ErrorMessage);
+    if (!WorldPartition)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+    }
+
+    const FVector BoxMin = FUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("box_min"));
+    const FVector BoxMax = FUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("box_max"));
+    const FBox Box(BoxMin.ComponentMin(BoxMax), BoxMin.ComponentMax(BoxMax));
+
+    const FString Handle = FString::Printf(TEXT("region_%d"), NextRegionId++);
+
+    // Same mechanism as a user-created region in the World Partition editor, so only
+    // the actors whose bounds touch the box are loaded
+    UWorldPartitionEditorLoaderAdapter* EditorLoaderAdapter = WorldPartition->CreateEditorLoaderAdapter<FLoaderAdapterShape>(WorldPartition->GetWorld(), Box, Handle);
+    if (!EditorLoaderAdapter || !EditorLoaderAdapter->GetLoaderAdapter())
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create world partition loader adapter"));
+    }
+
+    EditorLoaderAdapter->GetLoaderAdapter()->SetUserCreated(true);
+    EditorLoaderAdapter->GetLoaderAdapter()->Load();
+    LoadedRegions.Add(Handle, EditorLoaderAdapter);
+
+    int32 LoadedCount = 0;
+    FWorldPartitionHelpers::ForEachActorDescInstance(WorldPartition, AActor::StaticClass(), [&Box, &LoadedCount](const FWorldPartitionActorDescInstance* ActorDesc)
+    {
+        if (ActorDesc->IsLoaded() && Box.Intersect(ActorDesc->GetEditorBounds()))
+        {
+            ++LoadedCount;
+        }
+        return true;
+    });
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("handle"), Handle);
+    ResultObj->SetNumberField(TEXT("loaded_actors"), LoadedCount);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPWorldPartitionCommands::HandleUnloadRegion(const TSharedPtr<FJsonObject>& Params)
+{
+    FString Handle;
+    if (!Params->TryGetStringField(TEXT("handle"), Handle))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'handle' parameter"));
+    }
+
+    TWeakObjectPtr<UWorldPartitionEditorLoaderAdapter> EditorLoaderAdapter;
+    if (!LoadedRegions.RemoveAndCopyValue(Handle, EditorLoaderAdapter))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Region not found: %s"), *Handle));
+    }
+
+    FString ErrorMessage;
+    UWorldPartition* WorldPartition = GetEditorWorldPartition(ErrorMessage);
+    if (EditorLoaderAdapter.IsValid() && WorldPartition)
+    {
+        EditorLoaderAdapter->GetLoaderAdapter()->Unload();
+        WorldPartition->ReleaseEditorLoaderAdapter(EditorLoaderAdapter.Get());
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("handle"), Handle);
+    ResultObj->SetBoolField(TEXT("unloaded"), true);
+    return ResultObj;
+}
+
+UWorldPartition* FUnrealMCPWorldPartitionCommands::GetEditorWorldPartition(FString& OutErrorMessage)
+{
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        OutErrorMessage = TEXT("Failed to get editor world");
+        return nullptr;
+    }
+
+    UWorldPartition* WorldPartition = World->GetWorldPartition();
+    if (!WorldPartition)
+    {
+        OutErrorMessage = TEXT("The current level does not use World Partition; use get_actors_in_level instead");
+        return nullptr;
+    }
+    return WorldPartition;
+}
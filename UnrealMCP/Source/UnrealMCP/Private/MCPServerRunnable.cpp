@@ -1,5 +1,8 @@
 #include "MCPServerRunnable.h"
 #include "UnrealMCPBridge.h"
+#include "UnrealMCPJsonDocument.h"
+#include "UnrealMCPJsonWriter.h"
+#include "UnrealMCPMessagePackWriter.h"
 #include "Sockets.h"
 #include "SocketSubsystem.h"
 #include "Interfaces/IPv4/IPv4Address.h"
@@ -14,10 +17,19 @@
 // Buffer size for receiving data
 const int32 BufferSize = 8192;
 
+// Upper bound on a single buffered request, to stop a client without closing brackets from exhausting memory
+const int32 MaxRequestSize = 256 * 1024 * 1024;
+
+static bool IsJsonWhitespace(uint8 Byte)
+{
+    return Byte == ' ' || Byte == '\t' || Byte == '\r' || Byte == '\n';
+}
+
 FMCPServerRunnable::FMCPServerRunnable(UUnrealMCPBridge* InBridge, TSharedPtr<FSocket> InListenerSocket)
     : Bridge(InBridge)
     , ListenerSocket(InListenerSocket)
     , bRunning(true)
+    , bMessagePack(false)
 {
     UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Created server runnable"));
 }
@@ -57,6 +69,11 @@ uint32 FMCPServerRunnable::Run()
                 ClientSocket->SetReceiveBufferSize(SocketBufferSize, SocketBufferSize);
                 
                 uint8 Buffer[8192];
+                TArray<uint8> PendingBytes;
+                FUnrealMCPJsonDocument::FScanState ScanState;
+
+                // Every connection starts out speaking JSON until it asks for something else
+                bMessagePack = false;
                 while (bRunning)
                 {
                     int32 BytesRead = 0;
@@ -68,45 +85,75 @@ uint32 FMCPServerRunnable::Run()
                             break;
                         }
 
-                        // Convert received data to string
-                        Buffer[BytesRead] = '\0';
-                        FString ReceivedText = UTF8_TO_TCHAR(Buffer);
-                        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Received: %s"), *ReceivedText);
+                        // A request can span several reads, so buffer until a whole document has arrived
+                        PendingBytes.Append(Buffer, BytesRead);
+                        if (PendingBytes.Num() > MaxRequestSize)
+                        {
+                            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Request exceeds %d bytes, dropping connection"), MaxRequestSize);
+                            break;
+                        }
 
-                        // Parse JSON
-                        TSharedPtr<FJsonObject> JsonObject;
-                        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ReceivedText);
-                        
-                        if (FJsonSerializer::Deserialize(Reader, JsonObject))
+                        // Handle every complete request; the encoding can change between two of them
+                        bool bDropConnection = false;
+                        while (PendingBytes.Num() > 0)
                         {
-                            // Get command type
-                            FString CommandType;
-                            if (JsonObject->TryGetStringField(TEXT("type"), CommandType))
+                            int32 ConsumedBytes = 0;
+                            if (bMessagePack)
                             {
-                                // Execute command
-                                FString Response = Bridge->ExecuteCommand(CommandType, JsonObject->GetObjectField(TEXT("params")));
-                                
-                                // Log response for debugging
-                                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Sending response: %s"), *Response);
-                                
-                                // Send response
-                                int32 BytesSent = 0;
-                                if (!ClientSocket->Send((uint8*)TCHAR_TO_UTF8(*Response), Response.Len(), BytesSent))
+                                // MessagePack requests carry a 4 byte big-endian length prefix
+                                if (PendingBytes.Num() < 4)
                                 {
-                                    UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to send response"));
+                                    break;
                                 }
-                                else {
-                                    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Response sent successfully, bytes: %d"), BytesSent);
+
+                                const uint32 MessageLength = ((uint32)PendingBytes[0] << 24) | ((uint32)PendingBytes[1] << 16) |
+                                                             ((uint32)PendingBytes[2] << 8) | (uint32)PendingBytes[3];
+                                if (MessageLength > (uint32)MaxRequestSize)
+                                {
+                                    // The rest of the frame would be read as new length prefixes, so the stream cannot be resynced
+                                    UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Request exceeds %d bytes, dropping connection"), MaxRequestSize);
+                                    bDropConnection = true;
+                                    break;
+                                }
+                                if (PendingBytes.Num() < 4 + (int32)MessageLength)
+                                {
+                                    break;
                                 }
+
+                                ConsumedBytes = 4 + (int32)MessageLength;
+                                ProcessRequest(PendingBytes.GetData() + 4, (int32)MessageLength);
                             }
                             else
                             {
-                                UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Missing 'type' field in command"));
+                                const int32 DocumentEnd = FUnrealMCPJsonDocument::FindDocumentEnd(PendingBytes.GetData(), PendingBytes.Num(), ScanState);
+                                if (DocumentEnd == 0)
+                                {
+                                    break;
+                                }
+
+                                ScanState = FUnrealMCPJsonDocument::FScanState();
+                                if (DocumentEnd < 0)
+                                {
+                                    UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Received data that is not a JSON object, discarding %d bytes"), PendingBytes.Num());
+                                    PendingBytes.Reset();
+                                    break;
+                                }
+
+                                // Also take the whitespace after the document, usually a newline delimiter, so that
+                                // it is not read as the start of a length prefix if this request switches to MessagePack
+                                ConsumedBytes = DocumentEnd;
+                                while (ConsumedBytes < PendingBytes.Num() && IsJsonWhitespace(PendingBytes[ConsumedBytes]))
+                                {
+                                    ++ConsumedBytes;
+                                }
+                                ProcessRequest(PendingBytes.GetData(), DocumentEnd);
                             }
+                            PendingBytes.RemoveAt(0, ConsumedBytes, EAllowShrinking::No);
                         }
-                        else
+
+                        if (bDropConnection)
                         {
-                            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to parse JSON from: %s"), *ReceivedText);
+                            break;
                         }
                     }
                     else
@@ -155,6 +202,131 @@ uint32 FMCPServerRunnable::Run()
     return 0;
 }
 
+void FMCPServerRunnable::ProcessRequest(const uint8* Data, int32 Length)
+{
+    // The whole request lives in one document that is freed when this function returns
+    TSharedRef<FUnrealMCPJsonDocument> Request = MakeShared<FUnrealMCPJsonDocument>();
+    FString ParseError;
+    const bool bParsed = bMessagePack
+        ? Request->ParseMessagePack(Data, Length, ParseError)
+        : Request->Parse(Data, Length, ParseError);
+    if (!bParsed || !Request->GetRoot().IsObject())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to parse %s request: %s"),
+               bMessagePack ? TEXT("MessagePack") : TEXT("JSON"), *ParseError);
+        return;
+    }
+
+    // Get command type
+    FString CommandType;
+    if (!Request->GetRoot().TryGetStringField(TEXT("type"), CommandType))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Missing 'type' field in command"));
+        return;
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Received %s (%d bytes)"), *CommandType, Length);
+
+    // Encoding negotiation is answered here, in the current encoding, before switching
+    if (CommandType == TEXT("set_encoding"))
+    {
+        HandleSetEncoding(Request->GetRoot().Find(TEXT("params")));
+        return;
+    }
+
+    // Execute command; the response comes back already in the connection's encoding
+    TArray<uint8> Response;
+    Bridge->ExecuteRequestUtf8(CommandType, Request, bMessagePack, Response);
+    SendResponse(Response);
+}
+
+void FMCPServerRunnable::HandleSetEncoding(const FUnrealMCPJsonView& Params)
+{
+    FString Encoding;
+    Params.TryGetStringField(TEXT("encoding"), Encoding);
+
+    TArray<uint8> Response;
+    FUnrealMCPJsonWriter JsonWriter(Response);
+    FUnrealMCPMessagePackWriter MessagePackWriter(Response);
+    FUnrealMCPJsonWriter& Writer = bMessagePack ? MessagePackWriter : JsonWriter;
+    Writer.BeginObject();
+    if (Encoding == TEXT("json") || Encoding == TEXT("msgpack"))
+    {
+        Writer.WriteStringField(TEXT("status"), TEXT("success"));
+        Writer.WriteKey(TEXT("result"));
+        Writer.BeginObject();
+        Writer.WriteStringField(TEXT("encoding"), Encoding);
+        Writer.WriteStringField(TEXT("framing"), Encoding == TEXT("msgpack") ? TEXT("u32_big_endian_length_prefix") : TEXT("none"));
+        Writer.EndObject();
+    }
+    else
+    {
+        Writer.WriteStringField(TEXT("status"), TEXT("error"));
+        Writer.WriteStringField(TEXT("error"), FString::Printf(TEXT("Unsupported encoding '%s', expected 'json' or 'msgpack'"), *Encoding));
+    }
+    Writer.EndObject();
+    SendResponse(Response);
+
+    if (Encoding == TEXT("json") || Encoding == TEXT("msgpack"))
+    {
+        bMessagePack = Encoding == TEXT("msgpack");
+        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Connection switched to %s"), *Encoding);
+    }
+}
+
+void FMCPServerRunnable::SendResponse(const TArray<uint8>& Response)
+{
+    bool bSent = false;
+    int32 BytesSent = Response.Num();
+    if (bMessagePack)
+    {
+        // Already MessagePack; it only needs the length prefix that frames it
+        TArray<uint8> Header;
+        const uint32 PayloadLength = (uint32)Response.Num();
+        Header.Add((uint8)(PayloadLength >> 24));
+        Header.Add((uint8)(PayloadLength >> 16));
+        Header.Add((uint8)(PayloadLength >> 8));
+        Header.Add((uint8)PayloadLength);
+
+        BytesSent += Header.Num();
+        bSent = SendAll(Header) && SendAll(Response);
+    }
+    else
+    {
+        bSent = SendAll(Response);
+    }
+
+    if (!bSent)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to send response"));
+    }
+    else
+    {
+        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Response sent successfully, bytes: %d"), BytesSent);
+    }
+}
+
+bool FMCPServerRunnable::SendAll(const TArray<uint8>& Data)
+{
+    // Send can accept fewer bytes than asked for, so keep going until everything is out
+    int32 TotalSent = 0;
+    while (TotalSent < Data.Num())
+    {
+        int32 BytesSent = 0;
+        if (!ClientSocket->Send(Data.GetData() + TotalSent, Data.Num() - TotalSent, BytesSent))
+        {
+            if (ISocketSubsystem::Get()->GetLastErrorCode() == SE_EWOULDBLOCK)
+            {
+                FPlatformProcess::Sleep(0.001f);
+                continue;
+            }
+            return false;
+        }
+        TotalSent += BytesSent;
+    }
+    return true;
+}
+
 void FMCPServerRunnable::Stop()
 {
     bRunning = false;
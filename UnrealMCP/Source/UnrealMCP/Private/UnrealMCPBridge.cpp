@@ -56,12 +56,30 @@
 #include "Commands/UnrealMCPProjectCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
 #include "Commands/UnrealMCPUMGCommands.h"
+#include "Commands/UnrealMCPInstanceCommands.h"
+#include "Commands/UnrealMCPSnapshotCommands.h"
+#include "Commands/UnrealMCPWorldPartitionCommands.h"
+#include "Commands/UnrealMCPCompileQueue.h"
+#include "Commands/UnrealMCPApiSearch.h"
 #include "PythonScriptEngine.h"
+#include "UnrealMCPJsonWriter.h"
+#include "UnrealMCPMessagePackWriter.h"
+#include "UnrealMCPJsonDocument.h"
 
 // Default settings
 #define MCP_SERVER_HOST "127.0.0.1"
 #define MCP_SERVER_PORT 55557
 
+// Writer for the connection's encoding; both take the same calls
+static TUniquePtr<FUnrealMCPJsonWriter> MakeResponseWriter(TArray<uint8>& Buffer, bool bMessagePack)
+{
+    if (bMessagePack)
+    {
+        return MakeUnique<FUnrealMCPMessagePackWriter>(Buffer);
+    }
+    return MakeUnique<FUnrealMCPJsonWriter>(Buffer);
+}
+
 UUnrealMCPBridge::UUnrealMCPBridge()
 {
     EditorCommands = MakeShared<FUnrealMCPEditorCommands>();
@@ -69,6 +87,9 @@ UUnrealMCPBridge::UUnrealMCPBridge()
     BlueprintNodeCommands = MakeShared<FUnrealMCPBlueprintNodeCommands>();
     ProjectCommands = MakeShared<FUnrealMCPProjectCommands>();
     UMGCommands = MakeShared<FUnrealMCPUMGCommands>();
+    InstanceCommands = MakeShared<FUnrealMCPInstanceCommands>();
+    SnapshotCommands = MakeShared<FUnrealMCPSnapshotCommands>();
+    WorldPartitionCommands = MakeShared<FUnrealMCPWorldPartitionCommands>();
 }
 
 UUnrealMCPBridge::~UUnrealMCPBridge()
@@ -78,6 +99,9 @@ UUnrealMCPBridge::~UUnrealMCPBridge()
     BlueprintNodeCommands.Reset();
     ProjectCommands.Reset();
     UMGCommands.Reset();
+    InstanceCommands.Reset();
+    SnapshotCommands.Reset();
+    WorldPartitionCommands.Reset();
 }
 
 // Start the MCP server
@@ -179,105 +203,130 @@ void UUnrealMCPBridge::StopServer()
 
 // Execute a command received from a client
 FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    TArray<uint8> Response;
+    ExecuteCommandUtf8(CommandType, Params, Response);
+
+    FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Response.GetData()), Response.Num());
+    return FString(Converted.Length(), Converted.Get());
+}
+
+// Execute a command and return the response as UTF-8 bytes, ready to send
+void UUnrealMCPBridge::ExecuteCommandUtf8(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, TArray<uint8>& OutResponse)
+{
+    ExecuteOnGameThread(CommandType, Params, nullptr, false, OutResponse);
+}
+
+// Execute a request parsed by the server thread. The document is shared with the game thread
+// task and released in one piece once both are done with it. The response is written in the
+// connection's encoding, so MessagePack clients get no intermediate JSON.
+void UUnrealMCPBridge::ExecuteRequestUtf8(const FString& CommandType, const TSharedRef<const FUnrealMCPJsonDocument>& Request, bool bMessagePack, TArray<uint8>& OutResponse)
+{
+    ExecuteOnGameThread(CommandType, nullptr, Request, bMessagePack, OutResponse);
+}
+
+void UUnrealMCPBridge::ExecuteOnGameThread(const FString& CommandType, const TSharedPtr<FJsonObject>& InParams,
+                                           const TSharedPtr<const FUnrealMCPJsonDocument>& Request, bool bMessagePack, TArray<uint8>& OutResponse)
 {
     UE_LOG(LogTemp, Display, TEXT("UnrealMCPBridge: Executing command: %s"), *CommandType);
     
+    // API searches read a snapshot of plain strings, so once it exists they skip the game thread queue
+    if (FUnrealMCPApiSearch::IsSearchCommand(CommandType) && FUnrealMCPApiSearch::IsReady())
+    {
+        TSharedPtr<FJsonObject> Params = InParams;
+        if (!Params.IsValid())
+        {
+            const FUnrealMCPJsonView ParamsView = Request.IsValid() ? Request->GetRoot().Find(TEXT("params")) : FUnrealMCPJsonView();
+            Params = ParamsView.IsObject() ? ParamsView.ToJsonObject() : MakeShared<FJsonObject>();
+        }
+
+        const TSharedPtr<FJsonObject> ResultJson = FUnrealMCPApiSearch::HandleCommand(CommandType, Params);
+        TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
+        if (ResultJson->HasField(TEXT("success")) && !ResultJson->GetBoolField(TEXT("success")))
+        {
+            ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+            ResponseJson->SetStringField(TEXT("error"), ResultJson->GetStringField(TEXT("error")));
+        }
+        else
+        {
+            ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
+            ResponseJson->SetObjectField(TEXT("result"), ResultJson);
+        }
+
+        OutResponse.Reset();
+        MakeResponseWriter(OutResponse, bMessagePack)->WriteJsonObject(ResponseJson);
+        return;
+    }
+    
     // Create a promise to wait for the result
-    TPromise<FString> Promise;
-    TFuture<FString> Future = Promise.GetFuture();
+    TPromise<TArray<uint8>> Promise;
+    TFuture<TArray<uint8>> Future = Promise.GetFuture();
     
     // Queue execution on Game Thread
-    AsyncTask(ENamedThreads::GameThread, [this, CommandType, Params, Promise = MoveTemp(Promise)]() mutable
+    AsyncTask(ENamedThreads::GameThread, [this, CommandType, Params = InParams, Request, bMessagePack, Promise = MoveTemp(Promise)]() mutable
     {
         TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
+        TArray<uint8> ResponseBytes;
+        TUniquePtr<FUnrealMCPJsonWriter> ResponseWriter = MakeResponseWriter(ResponseBytes, bMessagePack);
+        
+        // A parsed request is read in place; DispatchRequest builds a DOM only for handlers that need one
+        const FUnrealMCPJsonView ParamsView = Request.IsValid() ? Request->GetRoot().Find(TEXT("params")) : FUnrealMCPJsonView();
         
         try
         {
-            TSharedPtr<FJsonObject> ResultJson;
-            
-            if (CommandType == TEXT("ping"))
-            {
-                ResultJson = MakeShareable(new FJsonObject);
-                ResultJson->SetStringField(TEXT("message"), TEXT("pong"));
-            }
-            // Editor Commands (including actor manipulation)
-            else if (CommandType == TEXT("get_actors_in_level") || 
-                     CommandType == TEXT("find_actors_by_name") ||
-                     CommandType == TEXT("spawn_actor") ||
-                     CommandType == TEXT("create_actor") ||
-                     CommandType == TEXT("delete_actor") || 
-                     CommandType == TEXT("set_actor_transform") ||
-                     CommandType == TEXT("get_actor_properties") ||
-                     CommandType == TEXT("set_actor_property") ||
-                     CommandType == TEXT("spawn_blueprint_actor") ||
-                     CommandType == TEXT("focus_viewport") || 
-                     CommandType == TEXT("take_screenshot"))
+            // Large listings write their result straight into the response buffer
+            const bool bInstanceStream = FUnrealMCPInstanceCommands::IsStreamingCommand(CommandType);
+            const bool bSnapshotStream = FUnrealMCPSnapshotCommands::IsStreamingCommand(CommandType);
+            if (bInstanceStream || bSnapshotStream || FUnrealMCPEditorCommands::IsStreamingCommand(CommandType))
             {
-                ResultJson = EditorCommands->HandleCommand(CommandType, Params);
-            }
-            // Blueprint Commands
-            else if (CommandType == TEXT("create_blueprint") || 
-                     CommandType == TEXT("add_component_to_blueprint") || 
-                     CommandType == TEXT("set_component_property") || 
-                     CommandType == TEXT("set_physics_properties") || 
-                     CommandType == TEXT("compile_blueprint") || 
-                     CommandType == TEXT("set_blueprint_property") || 
-                     CommandType == TEXT("set_static_mesh_properties") ||
-                     CommandType == TEXT("set_pawn_properties"))
-            {
-                ResultJson = BlueprintCommands->HandleCommand(CommandType, Params);
-            }
-            // Blueprint Node Commands
-            else if (CommandType == TEXT("connect_blueprint_nodes") || 
-                     CommandType == TEXT("add_blueprint_get_self_component_reference") ||
-                     CommandType == TEXT("add_blueprint_self_reference") ||
-                     CommandType == TEXT("find_blueprint_nodes") ||
-                     CommandType == TEXT("add_blueprint_event_node") ||
-                     CommandType == TEXT("add_blueprint_input_action_node") ||
-                     CommandType == TEXT("add_blueprint_function_node") ||
-                     CommandType == TEXT("add_blueprint_get_component_node") ||
-                     CommandType == TEXT("add_blueprint_variable"))
-            {
-                ResultJson = BlueprintNodeCommands->HandleCommand(CommandType, Params);
-            }
-            // Project Commands
-            else if (CommandType == TEXT("create_input_mapping"))
-            {
-                ResultJson = ProjectCommands->HandleCommand(CommandType, Params);
-            }
-            // UMG Commands
-            else if (CommandType == TEXT("create_umg_widget_blueprint") ||
-                     CommandType == TEXT("add_text_block_to_widget") ||
-                     CommandType == TEXT("add_button_to_widget") ||
-                     CommandType == TEXT("bind_widget_event") ||
-                     CommandType == TEXT("set_text_block_binding") ||
-                     CommandType == TEXT("add_widget_to_viewport"))
-            {
-                ResultJson = UMGCommands->HandleCommand(CommandType, Params);
-            }
-            else if (CommandType == TEXT("execute_python_script"))
-            {
-                FString PythonCode = Params->GetStringField(TEXT("code"));
-                
-                // Execute the Python script
-                bool bSuccess = FPythonScriptEngine::Get()->ExecuteScript(PythonCode);
+                if (!Params.IsValid())
+                {
+                    Params = ParamsView.IsObject() ? ParamsView.ToJsonObject() : MakeShared<FJsonObject>();
+                }
+
+                ResponseWriter->BeginObject();
+                ResponseWriter->WriteStringField(TEXT("status"), TEXT("success"));
+                ResponseWriter->WriteKey(TEXT("result"));
 
-                ResultJson = MakeShareable(new FJsonObject);
-                ResultJson->SetBoolField(TEXT("success"), bSuccess);
-                if (!bSuccess)
+                FString StreamError;
+                bool bStreamed = false;
+                if (bInstanceStream)
+                {
+                    bStreamed = InstanceCommands->StreamCommand(CommandType, Params, *ResponseWriter, StreamError);
+                }
+                else if (bSnapshotStream)
+                {
+                    bStreamed = SnapshotCommands->StreamCommand(CommandType, Params, *ResponseWriter, StreamError);
+                }
+                else
                 {
-                    ResultJson->SetStringField(TEXT("error"), TEXT("Python script execution failed. Check Unreal's Output Log for details."));
+                    bStreamed = EditorCommands->StreamCommand(CommandType, Params, *ResponseWriter, StreamError);
                 }
+                if (bStreamed)
+                {
+                    ResponseWriter->EndObject();
+                    Promise.SetValue(MoveTemp(ResponseBytes));
+                    return;
+                }
+
+                // Nothing was written for the result, fall through to an error envelope
+                ResponseBytes.Reset();
+                ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+                ResponseJson->SetStringField(TEXT("error"), StreamError);
+                MakeResponseWriter(ResponseBytes, bMessagePack)->WriteJsonObject(ResponseJson);
+                Promise.SetValue(MoveTemp(ResponseBytes));
+                return;
             }
-            else
+
+            const TSharedPtr<FJsonObject> ResultJson = Request.IsValid() ? DispatchRequest(CommandType, ParamsView) : DispatchCommand(CommandType, Params);
+
+            if (!ResultJson.IsValid())
             {
                 ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
                 ResponseJson->SetStringField(TEXT("error"), FString::Printf(TEXT("Unknown command: %s"), *CommandType));
                 
-                FString ResultString;
-                TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
-                FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
-                Promise.SetValue(ResultString);
+                ResponseWriter->WriteJsonObject(ResponseJson);
+                Promise.SetValue(MoveTemp(ResponseBytes));
                 return;
             }
             
@@ -313,11 +362,232 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
             ResponseJson->SetStringField(TEXT("error"), UTF8_TO_TCHAR(e.what()));
         }
         
-        FString ResultString;
-        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
-        FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
-        Promise.SetValue(ResultString);
+        // Serialize straight to UTF-8 instead of going through an FString
+        ResponseBytes.Reset();
+        MakeResponseWriter(ResponseBytes, bMessagePack)->WriteJsonObject(ResponseJson);
+        Promise.SetValue(MoveTemp(ResponseBytes));
     });
     
-    return Future.Get();
-}
\ No newline at end of file
+    OutResponse = Future.Get();
+}
+
+bool UUnrealMCPBridge::IsViewCommand(const FString& CommandType)
+{
+    return FUnrealMCPEditorCommands::IsViewCommand(CommandType) ||
+           FUnrealMCPInstanceCommands::IsViewCommand(CommandType) ||
+           CommandType == TEXT("execute_batch");
+}
+
+// Route a command whose parameters are a view into a request document. Handlers that read
+// views get it as is; the rest get a DOM of their own parameters. Returns null for an unknown command.
+TSharedPtr<FJsonObject> UUnrealMCPBridge::DispatchRequest(const FString& CommandType, const FUnrealMCPJsonView& Params)
+{
+    if (FUnrealMCPEditorCommands::IsViewCommand(CommandType))
+    {
+        return EditorCommands->HandleViewCommand(CommandType, Params);
+    }
+    if (FUnrealMCPInstanceCommands::IsViewCommand(CommandType))
+    {
+        return InstanceCommands->HandleViewCommand(CommandType, Params);
+    }
+    if (CommandType == TEXT("execute_batch"))
+    {
+        return HandleExecuteBatch(Params);
+    }
+    return DispatchCommand(CommandType, Params.IsObject() ? Params.ToJsonObject() : MakeShared<FJsonObject>());
+}
+
+// Route a command to its handler group. Returns null for an unknown command.
+TSharedPtr<FJsonObject> UUnrealMCPBridge::DispatchCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    TSharedPtr<FJsonObject> ResultJson;
+
+    // Only in-process callers of ExecuteCommand get here with a DOM for a view command;
+    // requests from the server are routed through DispatchRequest and never take this copy
+    if (IsViewCommand(CommandType))
+    {
+        const TSharedRef<FUnrealMCPJsonDocument> Document = FUnrealMCPJsonDocument::FromJsonObject(Params);
+        return DispatchRequest(CommandType, Document->GetRoot());
+    }
+
+    if (CommandType == TEXT("ping"))
+    {
+        ResultJson = MakeShareable(new FJsonObject);
+        ResultJson->SetStringField(TEXT("message"), TEXT("pong"));
+    }
+    // Editor Commands (including actor manipulation)
+    else if (CommandType == TEXT("get_actors_in_level") || 
+             CommandType == TEXT("find_actors_by_name") ||
+             CommandType == TEXT("spawn_actor") ||
+             CommandType == TEXT("create_actor") ||
+             CommandType == TEXT("delete_actor") || 
+             CommandType == TEXT("set_actor_transform") ||
+             CommandType == TEXT("get_actor_properties") ||
+             CommandType == TEXT("set_actor_property") ||
+             CommandType == TEXT("set_property_bulk") ||
+             CommandType == TEXT("spawn_blueprint_actor") ||
+             CommandType == TEXT("focus_viewport") || 
+             CommandType == TEXT("take_screenshot"))
+    {
+        ResultJson = EditorCommands->HandleCommand(CommandType, Params);
+    }
+    // Blueprint Commands
+    else if (CommandType == TEXT("create_blueprint") || 
+             CommandType == TEXT("add_component_to_blueprint") || 
+             CommandType == TEXT("set_component_property") || 
+             CommandType == TEXT("set_physics_properties") || 
+             CommandType == TEXT("compile_blueprint") || 
+             CommandType == TEXT("compile_blueprints") ||
+             CommandType == TEXT("set_blueprint_property") || 
+             CommandType == TEXT("set_static_mesh_properties") ||
+             CommandType == TEXT("set_pawn_properties") ||
+             CommandType == TEXT("audit_blueprint_performance"))
+    {
+        ResultJson = BlueprintCommands->HandleCommand(CommandType, Params);
+    }
+    // Blueprint Node Commands
+    else if (CommandType == TEXT("connect_blueprint_nodes") || 
+             CommandType == TEXT("add_blueprint_get_self_component_reference") ||
+             CommandType == TEXT("add_blueprint_self_reference") ||
+             CommandType == TEXT("find_blueprint_nodes") ||
+             CommandType == TEXT("get_blueprint_graph") ||
+             CommandType == TEXT("build_blueprint_graph") ||
+             CommandType == TEXT("search_blueprint_nodes") ||
+             CommandType == TEXT("add_blueprint_event_node") ||
+             CommandType == TEXT("add_blueprint_input_action_node") ||
+             CommandType == TEXT("add_blueprint_function_node") ||
+             CommandType == TEXT("add_blueprint_get_component_node") ||
+             CommandType == TEXT("add_blueprint_variable"))
+    {
+        ResultJson = BlueprintNodeCommands->HandleCommand(CommandType, Params);
+    }
+    // Project Commands
+    else if (CommandType == TEXT("create_input_mapping"))
+    {
+        ResultJson = ProjectCommands->HandleCommand(CommandType, Params);
+    }
+    // UMG Commands
+    else if (CommandType == TEXT("create_umg_widget_blueprint") ||
+             CommandType == TEXT("add_text_block_to_widget") ||
+             CommandType == TEXT("add_button_to_widget") ||
+             CommandType == TEXT("bind_widget_event") ||
+             CommandType == TEXT("set_text_block_binding") ||
+             CommandType == TEXT("add_widget_to_viewport"))
+    {
+        ResultJson = UMGCommands->HandleCommand(CommandType, Params);
+    }
+    // Instanced Mesh Commands
+    else if (CommandType == TEXT("get_mesh_instances") ||
+             CommandType == TEXT("update_mesh_instances") ||
+             CommandType == TEXT("remove_mesh_instances") ||
+             CommandType == TEXT("scatter_instances"))
+    {
+        ResultJson = InstanceCommands->HandleCommand(CommandType, Params);
+    }
+    // Level Snapshot Commands
+    else if (CommandType == TEXT("export_level_snapshot") ||
+             CommandType == TEXT("create_snapshot") ||
+             CommandType == TEXT("diff_snapshots") ||
+             CommandType == TEXT("delete_snapshot"))
+    {
+        ResultJson = SnapshotCommands->HandleCommand(CommandType, Params);
+    }
+    // World Partition Commands
+    else if (CommandType == TEXT("query_world_partition_actors") ||
+             CommandType == TEXT("load_world_partition_region") ||
+             CommandType == TEXT("unload_world_partition_region"))
+    {
+        ResultJson = WorldPartitionCommands->HandleCommand(CommandType, Params);
+    }
+    // API Search Commands
+    else if (FUnrealMCPApiSearch::IsSearchCommand(CommandType))
+    {
+        ResultJson = FUnrealMCPApiSearch::HandleCommand(CommandType, Params);
+    }
+    else if (CommandType == TEXT("execute_python_script"))
+    {
+        FString PythonCode = Params->GetStringField(TEXT("code"));
+        
+        // Execute the Python script
+        bool bSuccess = FPythonScriptEngine::Get()->ExecuteScript(PythonCode);
+
+        ResultJson = MakeShareable(new FJsonObject);
+        ResultJson->SetBoolField(TEXT("success"), bSuccess);
+        if (!bSuccess)
+        {
+            ResultJson->SetStringField(TEXT("error"), TEXT("Python script execution failed. Check Unreal's Output Log for details."));
+        }
+    }
+
+    return ResultJson;
+}
+
+// Run a list of commands in one game thread task. Blueprint edits made along the way are
+// compiled together once the last command has run, instead of after each one.
+TSharedPtr<FJsonObject> UUnrealMCPBridge::HandleExecuteBatch(const FUnrealMCPJsonView& Params)
+{
+    FUnrealMCPJsonView Commands;
+    if (!Params.TryGetArrayField(TEXT("commands"), Commands))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'commands' parameter"));
+    }
+
+    bool bStopOnError = false;
+    Params.TryGetBoolField(TEXT("stop_on_error"), bStopOnError);
+
+    TArray<TSharedPtr<FJsonValue>> Results;
+    int32 FailedCount = 0;
+    bool bStopped = false;
+    Commands.ForEachElement([this, bStopOnError, &Results, &FailedCount, &bStopped](const FUnrealMCPJsonView& CommandValue)
+    {
+        if (bStopped)
+        {
+            return;
+        }
+
+        FString SubCommandType;
+        TSharedPtr<FJsonObject> SubResult;
+        if (!CommandValue.IsObject() || !CommandValue.TryGetStringField(TEXT("type"), SubCommandType))
+        {
+            SubResult = FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Batch entry is missing 'type'"));
+        }
+        else if (SubCommandType == TEXT("execute_batch"))
+        {
+            SubResult = FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Batches cannot be nested"));
+        }
+        else
+        {
+            // Each entry's params stay a view into the batch request
+            SubResult = DispatchRequest(SubCommandType, CommandValue.Find(TEXT("params")));
+            if (!SubResult.IsValid())
+            {
+                SubResult = FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown command: %s"), *SubCommandType));
+            }
+        }
+
+        const bool bSubSuccess = !SubResult->HasField(TEXT("success")) || SubResult->GetBoolField(TEXT("success"));
+        TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+        Entry->SetStringField(TEXT("type"), SubCommandType);
+        Entry->SetStringField(TEXT("status"), bSubSuccess ? TEXT("success") : TEXT("error"));
+        if (bSubSuccess)
+        {
+            Entry->SetObjectField(TEXT("result"), SubResult);
+        }
+        else
+        {
+            Entry->SetStringField(TEXT("error"), SubResult->GetStringField(TEXT("error")));
+            ++FailedCount;
+        }
+        Results.Add(MakeShared<FJsonValueObject>(Entry));
+
+        bStopped = !bSubSuccess && bStopOnError;
+    });
+
+    const int32 CompiledCount = FUnrealMCPCompileQueue::Flush();
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetArrayField(TEXT("results"), Results);
+    ResultObj->SetNumberField(TEXT("failed_count"), FailedCount);
+    ResultObj->SetNumberField(TEXT("compiled_count"), CompiledCount);
+    return ResultObj;
+}
@@ -0,0 +1,203 @@
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "UnrealMCPJsonDocument.h"
+#include "UnrealMCPJsonScanner.h"
+#include "UnrealMCPJsonWriter.h"
+
+/**
+ * UnrealMCP.Json.Benchmark [SizeMB] [Iterations]
+ *
+ * Builds representative request payloads and times three ways of turning the received
+ * bytes into something a handler can read: FJsonSerializer on a converted FString (the
+ * previous server path), the tape parser with the scalar scanner, and the tape parser
+ * with the SIMD scanner. Framing (finding the end of the document) is included in the
+ * tape timings, since the server does it on every request.
+ */
+class FUnrealMCPJsonBenchmark
+{
+public:
+    static void Run(const TArray<FString>& Args)
+    {
+        const int32 SizeMB = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 4;
+        const int32 Iterations = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 5;
+        const int32 TargetBytes = SizeMB * 1024 * 1024;
+
+        UE_LOG(LogTemp, Display, TEXT("UnrealMCP JSON benchmark: ~%d MB payloads, %d iterations, SIMD path: %s"),
+            SizeMB, Iterations, FUnrealMCPJsonScanner::GetInstructionSetName());
+
+        TArray<uint8> Payload;
+        BuildTransformsPayload(TargetBytes, Payload);
+        Measure(TEXT("set_actor_transforms"), Payload, Iterations);
+
+        BuildInstancesPayload(TargetBytes, Payload);
+        Measure(TEXT("add_mesh_instances"), Payload, Iterations);
+
+        BuildPythonPayload(TargetBytes, Payload);
+        Measure(TEXT("execute_python_script"), Payload, Iterations);
+    }
+
+private:
+    // Flat structure-of-arrays transform columns, the bulk form of set_actor_transforms
+    static void BuildTransformsPayload(int32 TargetBytes, TArray<uint8>& OutPayload)
+    {
+        OutPayload.Reset();
+        FRandomStream Random(1);
+        const int32 Count = TargetBytes / 160;
+
+        FUnrealMCPJsonWriter Writer(OutPayload);
+        Writer.BeginObject();
+        Writer.WriteStringField(TEXT("type"), TEXT("set_actor_transforms"));
+        Writer.WriteKey(TEXT("params"));
+        Writer.BeginObject();
+        Writer.WriteKey(TEXT("actors"));
+        Writer.BeginArray();
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            Writer.WriteString(FString::Printf(TEXT("StaticMeshActor_%d"), Index));
+        }
+        Writer.EndArray();
+        for (const TCHAR* Column : { TEXT("locations"), TEXT("rotations"), TEXT("scales") })
+        {
+            Writer.WriteKey(Column);
+            Writer.BeginArray();
+            for (int32 Index = 0; Index < Count * 3; ++Index)
+            {
+                Writer.WriteNumber(Random.FRandRange(-100000.0f, 100000.0f));
+            }
+            Writer.EndArray();
+        }
+        Writer.EndObject();
+        Writer.EndObject();
+    }
+
+    // Array-of-objects transforms, the verbose form of add_mesh_instances
+    static void BuildInstancesPayload(int32 TargetBytes, TArray<uint8>& OutPayload)
+    {
+        OutPayload.Reset();
+        FRandomStream Random(2);
+        const int32 Count = TargetBytes / 180;
+
+        FUnrealMCPJsonWriter Writer(OutPayload);
+        Writer.BeginObject();
+        Writer.WriteStringField(TEXT("type"), TEXT("add_mesh_instances"));
+        Writer.WriteKey(TEXT("params"));
+        Writer.BeginObject();
+        Writer.WriteStringField(TEXT("actor_name"), TEXT("Foliage"));
+        Writer.WriteStringField(TEXT("mesh"), TEXT("/Engine/BasicShapes/Cube.Cube"));
+        Writer.WriteKey(TEXT("transforms"));
+        Writer.BeginArray();
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            Writer.BeginObject();
+            Writer.WriteKey(TEXT("location"));
+            Writer.WriteVector(Random.GetUnitVector() * Random.FRandRange(0.0f, 50000.0f));
+            Writer.WriteKey(TEXT("rotation"));
+            Writer.WriteRotator(FRotator(0.0f, Random.FRandRange(0.0f, 360.0f), 0.0f));
+            Writer.WriteKey(TEXT("scale"));
+            Writer.WriteVector(FVector(Random.FRandRange(0.5f, 2.0f)));
+            Writer.EndObject();
+        }
+        Writer.EndArray();
+        Writer.EndObject();
+        Writer.EndObject();
+    }
+
+    // One long string with the escapes and non-ASCII text found in real scripts
+    static void BuildPythonPayload(int32 TargetBytes, TArray<uint8>& OutPayload)
+    {
+        OutPayload.Reset();
+        const FString Line = TEXT("actor = unreal.EditorLevelLibrary.spawn_actor_from_class(unreal.StaticMeshActor, unreal.Vector(0, 0, 0))\n")
+                             TEXT("actor.set_actor_label(\"Caf\u00E9 \\\"mesh\\\"\")\t# \u30C6\u30B9\u30C8\n");
+        FString Code;
+        Code.Reserve(TargetBytes);
+        while (Code.Len() < TargetBytes)
+        {
+            Code += Line;
+        }
+
+        FUnrealMCPJsonWriter Writer(OutPayload);
+        Writer.BeginObject();
+        Writer.WriteStringField(TEXT("type"), TEXT("execute_python_script"));
+        Writer.WriteKey(TEXT("params"));
+        Writer.BeginObject();
+        Writer.WriteStringField(TEXT("code"), Code);
+        Writer.EndObject();
+        Writer.EndObject();
+    }
+
+    static void Measure(const TCHAR* Label, const TArray<uint8>& Payload, int32 Iterations)
+    {
+        IConsoleVariable* VectorizedVar = IConsoleManager::Get().FindConsoleVariable(TEXT("UnrealMCP.Json.Vectorized"));
+        const bool bWasVectorized = VectorizedVar ? VectorizedVar->GetBool() : true;
+
+        const double DomSeconds = TimeBest(Iterations, [&Payload]()
+        {
+            FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Payload.GetData()), Payload.Num());
+            const FString Text(Converted.Length(), Converted.Get());
+            TSharedPtr<FJsonObject> Object;
+            return FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Text), Object) && Object.IsValid();
+        });
+
+        auto ParseTape = [&Payload]()
+        {
+            FUnrealMCPJsonDocument::FScanState ScanState;
+            const int32 DocumentEnd = FUnrealMCPJsonDocument::FindDocumentEnd(Payload.GetData(), Payload.Num(), ScanState);
+            FUnrealMCPJsonDocument Document;
+            FString ErrorMessage;
+            return DocumentEnd == Payload.Num() && Document.Parse(Payload.GetData(), DocumentEnd, ErrorMessage);
+        };
+
+        if (VectorizedVar)
+        {
+            VectorizedVar->Set(false, ECVF_SetByConsole);
+        }
+        const double ScalarSeconds = TimeBest(Iterations, ParseTape);
+
+        if (VectorizedVar)
+        {
+            VectorizedVar->Set(true, ECVF_SetByConsole);
+        }
+        const double SimdSeconds = TimeBest(Iterations, ParseTape);
+
+        if (VectorizedVar)
+        {
+            VectorizedVar->Set(bWasVectorized, ECVF_SetByConsole);
+        }
+
+        const double MegaBytes = Payload.Num() / (1024.0 * 1024.0);
+        UE_LOG(LogTemp, Display, TEXT("  %-22s %6.2f MB | FJsonSerializer %8.2f ms (%7.1f MB/s) | tape scalar %8.2f ms (%7.1f MB/s) | tape SIMD %8.2f ms (%7.1f MB/s)"),
+            Label, MegaBytes,
+            DomSeconds * 1000.0, MegaBytes / DomSeconds,
+            ScalarSeconds * 1000.0, MegaBytes / ScalarSeconds,
+            SimdSeconds * 1000.0, MegaBytes / SimdSeconds);
+    }
+
+    // Best of N wall-clock runs; a failed parse is reported and counted as infinitely slow
+    static double TimeBest(int32 Iterations, TFunctionRef<bool()> Body)
+    {
+        double Best = TNumericLimits<double>::Max();
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            const double Start = FPlatformTime::Seconds();
+            const bool bOk = Body();
+            const double Elapsed = FPlatformTime::Seconds() - Start;
+            if (!bOk)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("UnrealMCP JSON benchmark: parse failed"));
+                return TNumericLimits<double>::Max();
+            }
+            Best = FMath::Min(Best, Elapsed);
+        }
+        return Best;
+    }
+};
+
+static FAutoConsoleCommand JsonBenchmarkCommand(
+    TEXT("UnrealMCP.Json.Benchmark"),
+    TEXT("Compare request parsing throughput: FJsonSerializer vs the tape parser (scalar and SIMD). Args: [SizeMB=4] [Iterations=5]"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&FUnrealMCPJsonBenchmark::Run));
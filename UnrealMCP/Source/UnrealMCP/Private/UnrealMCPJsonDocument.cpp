@@ -0,0 +1,758 @@
+#include "UnrealMCPJsonDocument.h"
+#include "UnrealMCPJsonWriter.h"
+#include "UnrealMCPJsonScanner.h"
+
+// Deeper nesting than this is rejected instead of risking the parser's stack
+const int32 MaxJsonDepth = 512;
+
+/**
+ * Recursive descent parser writing straight into a document's tape.
+ * Strings are decoded from UTF-8 into the document's TCHAR arena as they are read.
+ */
+struct FUnrealMCPJsonParser
+{
+    FUnrealMCPJsonParser(FUnrealMCPJsonDocument& InDocument, const uint8* InData, int32 InLength)
+        : Document(InDocument)
+        , Data(InData)
+        , Length(InLength)
+    {
+    }
+
+    static bool IsWhitespace(uint8 Char)
+    {
+        return Char == ' ' || Char == '\t' || Char == '\n' || Char == '\r';
+    }
+
+    static int32 HexDigitValue(uint8 Char)
+    {
+        if (Char >= '0' && Char <= '9') return Char - '0';
+        if (Char >= 'a' && Char <= 'f') return Char - 'a' + 10;
+        if (Char >= 'A' && Char <= 'F') return Char - 'A' + 10;
+        return INDEX_NONE;
+    }
+
+    FUnrealMCPJsonDocument& Document;
+    const uint8* Data;
+    int32 Length;
+    int32 Pos = 0;
+    FString Error;
+
+    bool Fail(const TCHAR* Message)
+    {
+        Error = FString::Printf(TEXT("%s at byte %d"), Message, Pos);
+        return false;
+    }
+
+    void SkipWhitespace()
+    {
+        while (Pos < Length && IsWhitespace(Data[Pos]))
+        {
+            ++Pos;
+        }
+    }
+
+    int32 AddNode(EJson Type)
+    {
+        const int32 NodeIndex = Document.Nodes.AddDefaulted();
+        FUnrealMCPJsonDocument::FNode& Node = Document.Nodes[NodeIndex];
+        Node.Type = Type;
+        Node.Next = NodeIndex + 1;
+        return NodeIndex;
+    }
+
+    void AppendCodePoint(uint32 CodePoint)
+    {
+        if (sizeof(TCHAR) == 2 && CodePoint > 0xFFFF)
+        {
+            CodePoint -= 0x10000;
+            Document.Strings.Add((TCHAR)(0xD800 + (CodePoint >> 10)));
+            Document.Strings.Add((TCHAR)(0xDC00 + (CodePoint & 0x3FF)));
+        }
+        else
+        {
+            Document.Strings.Add((TCHAR)CodePoint);
+        }
+    }
+
+    bool ParseHex4(uint32& OutValue)
+    {
+        if (Pos + 4 > Length)
+        {
+            return Fail(TEXT("Truncated \\u escape"));
+        }
+
+        OutValue = 0;
+        for (int32 Offset = 0; Offset < 4; ++Offset)
+        {
+            const int32 Digit = HexDigitValue(Data[Pos + Offset]);
+            if (Digit == INDEX_NONE)
+            {
+                return Fail(TEXT("Invalid \\u escape"));
+            }
+            OutValue = (OutValue << 4) | (uint32)Digit;
+        }
+        Pos += 4;
+        return true;
+    }
+
+    bool ParseEscape()
+    {
+        // Pos is just past the backslash
+        if (Pos >= Length)
+        {
+            return Fail(TEXT("Unterminated string"));
+        }
+
+        const uint8 Char = Data[Pos++];
+        switch (Char)
+        {
+        case '"':  Document.Strings.Add(TEXT('"')); return true;
+        case '\\': Document.Strings.Add(TEXT('\\')); return true;
+        case '/':  Document.Strings.Add(TEXT('/')); return true;
+        case 'b':  Document.Strings.Add(TEXT('\b')); return true;
+        case 'f':  Document.Strings.Add(TEXT('\f')); return true;
+        case 'n':  Document.Strings.Add(TEXT('\n')); return true;
+        case 'r':  Document.Strings.Add(TEXT('\r')); return true;
+        case 't':  Document.Strings.Add(TEXT('\t')); return true;
+        case 'u':
+        {
+            uint32 CodePoint = 0;
+            if (!ParseHex4(CodePoint))
+            {
+                return false;
+            }
+
+            // Combine a surrogate pair written as two escapes; lone surrogates become U+FFFD
+            if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF)
+            {
+                uint32 LowSurrogate = 0;
+                if (Pos + 1 < Length && Data[Pos] == '\\' && Data[Pos + 1] == 'u')
+                {
+                    Pos += 2;
+                    if (!ParseHex4(LowSurrogate))
+                    {
+                        return false;
+                    }
+                }
+
+                CodePoint = (LowSurrogate >= 0xDC00 && LowSurrogate <= 0xDFFF)
+                    ? 0x10000 + ((CodePoint - 0xD800) << 10) + (LowSurrogate - 0xDC00)
+                    : 0xFFFD;
+            }
+            else if (CodePoint >= 0xDC00 && CodePoint <= 0xDFFF)
+            {
+                CodePoint = 0xFFFD;
+            }
+
+            AppendCodePoint(CodePoint);
+            return true;
+        }
+        default:
+            --Pos;
+            return Fail(TEXT("Invalid escape sequence"));
+        }
+    }
+
+    bool ParseUtf8Sequence()
+    {
+        const uint8 Lead = Data[Pos];
+        int32 SequenceLength = 0;
+        uint32 CodePoint = 0;
+        if ((Lead & 0xE0) == 0xC0)
+        {
+            SequenceLength = 2;
+            CodePoint = Lead & 0x1F;
+        }
+        else if ((Lead & 0xF0) == 0xE0)
+        {
+            SequenceLength = 3;
+            CodePoint = Lead & 0x0F;
+        }
+        else if ((Lead & 0xF8) == 0xF0)
+        {
+            SequenceLength = 4;
+            CodePoint = Lead & 0x07;
+        }
+        else
+        {
+            return Fail(TEXT("Invalid UTF-8 lead byte"));
+        }
+
+        if (Pos + SequenceLength > Length)
+        {
+            return Fail(TEXT("Truncated UTF-8 sequence"));
+        }
+
+        for (int32 Offset = 1; Offset < SequenceLength; ++Offset)
+        {
+            const uint8 Continuation = Data[Pos + Offset];
+            if ((Continuation & 0xC0) != 0x80)
+            {
+                return Fail(TEXT("Invalid UTF-8 continuation byte"));
+            }
+            CodePoint = (CodePoint << 6) | (Continuation & 0x3F);
+        }
+
+        Pos += SequenceLength;
+        AppendCodePoint(CodePoint > 0x10FFFF ? 0xFFFD : CodePoint);
+        return true;
+    }
+
+    bool ParseString()
+    {
+        // Pos is on the opening quote
+        ++Pos;
+        const int32 NodeIndex = AddNode(EJson::String);
+        const int32 StringOffset = Document.Strings.Num();
+
+        while (true)
+        {
+            // Copy runs of plain ASCII in one go; only escapes and multi-byte characters take the slow path
+            const int32 RunStart = Pos;
+            Pos = FUnrealMCPJsonScanner::FindStringSpecial(Data, Pos, Length);
+            if (Pos > RunStart)
+            {
+                const int32 First = Document.Strings.AddUninitialized(Pos - RunStart);
+                TCHAR* Dest = Document.Strings.GetData() + First;
+                for (int32 Index = RunStart; Index < Pos; ++Index)
+                {
+                    *Dest++ = (TCHAR)Data[Index];
+                }
+            }
+
+            if (Pos >= Length)
+            {
+                return Fail(TEXT("Unterminated string"));
+            }
+
+            const uint8 Char = Data[Pos];
+            if (Char == '"')
+            {
+                ++Pos;
+                break;
+            }
+            if (Char == '\\')
+            {
+                ++Pos;
+                if (!ParseEscape())
+                {
+                    return false;
+                }
+            }
+            else if (Char < 0x20)
+            {
+                return Fail(TEXT("Control character in string"));
+            }
+            else if (!ParseUtf8Sequence())
+            {
+                return false;
+            }
+        }
+
+        FUnrealMCPJsonDocument::FNode& Node = Document.Nodes[NodeIndex];
+        Node.StringOffset = StringOffset;
+        Node.StringLength = Document.Strings.Num() - StringOffset;
+        return true;
+    }
+
+    bool ParseNumber()
+    {
+        const int32 Start = Pos;
+        auto SkipDigits = [this]()
+        {
+            const int32 DigitsStart = Pos;
+            while (Pos < Length && Data[Pos] >= '0' && Data[Pos] <= '9')
+            {
+                ++Pos;
+            }
+            return Pos > DigitsStart;
+        };
+
+        if (Pos < Length && Data[Pos] == '-')
+        {
+            ++Pos;
+        }
+        if (!SkipDigits())
+        {
+            Pos = Start;
+            return Fail(TEXT("Unexpected character"));
+        }
+        if (Pos < Length && Data[Pos] == '.')
+        {
+            ++Pos;
+            if (!SkipDigits())
+            {
+                return Fail(TEXT("Expected digits after decimal point"));
+            }
+        }
+        if (Pos < Length && (Data[Pos] == 'e' || Data[Pos] == 'E'))
+        {
+            ++Pos;
+            if (Pos < Length && (Data[Pos] == '+' || Data[Pos] == '-'))
+            {
+                ++Pos;
+            }
+            if (!SkipDigits())
+            {
+                return Fail(TEXT("Expected digits in exponent"));
+            }
+        }
+
+        // The input is not null terminated, so convert from a bounded copy
+        ANSICHAR NumberText[64];
+        const int32 NumberLength = Pos - Start;
+        if (NumberLength >= UE_ARRAY_COUNT(NumberText))
+        {
+            return Fail(TEXT("Number literal too long"));
+        }
+        FMemory::Memcpy(NumberText, Data + Start, NumberLength);
+        NumberText[NumberLength] = '\0';
+
+        const int32 NodeIndex = AddNode(EJson::Number);
+        Document.Nodes[NodeIndex].Number = FCStringAnsi::Atod(NumberText);
+        return true;
+    }
+
+    bool ParseLiteral(const ANSICHAR* Literal, EJson Type, double Value)
+    {
+        const int32 LiteralLength = FCStringAnsi::Strlen(Literal);
+        if (Pos + LiteralLength > Length || FMemory::Memcmp(Data + Pos, Literal, LiteralLength) != 0)
+        {
+            return Fail(TEXT("Unexpected character"));
+        }
+        Pos += LiteralLength;
+
+        const int32 NodeIndex = AddNode(Type);
+        Document.Nodes[NodeIndex].Number = Value;
+        return true;
+    }
+
+    bool ParseContainer(int32 Depth, bool bObject)
+    {
+        if (Depth >= MaxJsonDepth)
+        {
+            return Fail(TEXT("Nesting too deep"));
+        }
+
+        const int32 NodeIndex = AddNode(bObject ? EJson::Object : EJson::Array);
+        const uint8 Close = bObject ? '}' : ']';
+        int32 Count = 0;
+
+        ++Pos;
+        SkipWhitespace();
+        if (Pos < Length && Data[Pos] == Close)
+        {
+            ++Pos;
+        }
+        else
+        {
+            while (true)
+            {
+                if (bObject)
+                {
+                    // Keys are stored as string nodes immediately before their value
+                    SkipWhitespace();
+                    if (Pos >= Length || Data[Pos] != '"')
+                    {
+                        return Fail(TEXT("Expected field name"));
+                    }
+                    if (!ParseString())
+                    {
+                        return false;
+                    }
+                    SkipWhitespace();
+                    if (Pos >= Length || Data[Pos] != ':')
+                    {
+                        return Fail(TEXT("Expected ':'"));
+                    }
+                    ++Pos;
+                }
+
+                if (!ParseValue(Depth + 1))
+                {
+                    return false;
+                }
+                ++Count;
+
+                SkipWhitespace();
+                if (Pos >= Length)
+                {
+                    return Fail(TEXT("Unexpected end of input"));
+                }
+                if (Data[Pos] == ',')
+                {
+                    ++Pos;
+                    continue;
+                }
+                if (Data[Pos] == Close)
+                {
+                    ++Pos;
+                    break;
+                }
+                return Fail(bObject ? TEXT("Expected ',' or '}'") : TEXT("Expected ',' or ']'"));
+            }
+        }
+
+        FUnrealMCPJsonDocument::FNode& Node = Document.Nodes[NodeIndex];
+        Node.Count = Count;
+        Node.Next = Document.Nodes.Num();
+        return true;
+    }
+
+    bool ParseValue(int32 Depth)
+    {
+        SkipWhitespace();
+        if (Pos >= Length)
+        {
+            return Fail(TEXT("Unexpected end of input"));
+        }
+
+        switch (Data[Pos])
+        {
+        case '{': return ParseContainer(Depth, true);
+        case '[': return ParseContainer(Depth, false);
+        case '"': return ParseString();
+        case 't': return ParseLiteral("true", EJson::Boolean, 1.0);
+        case 'f': return ParseLiteral("false", EJson::Boolean, 0.0);
+        case 'n': return ParseLiteral("null", EJson::Null, 0.0);
+        default:  return ParseNumber();
+        }
+    }
+};
+
+bool FUnrealMCPJsonDocument::Parse(const uint8* Data, int32 Length, FString& OutErrorMessage)
+{
+    Nodes.Reset();
+    Strings.Reset();
+    Floats.Reset();
+
+    // Decoded strings never outgrow the input, so the arena needs a single allocation.
+    // The tape is only seeded at a node per 16 input bytes, about 1.5x the input, and grows
+    // from there; an upper bound (a node per 2 bytes) would reserve 12x the input.
+    Strings.Reserve(Length);
+    Nodes.Reserve(Length / 16 + 1);
+
+    FUnrealMCPJsonParser Parser(*this, Data, Length);
+    bool bParsed = Parser.ParseValue(0);
+    if (bParsed)
+    {
+        Parser.SkipWhitespace();
+        if (Parser.Pos != Length)
+        {
+            bParsed = Parser.Fail(TEXT("Unexpected data after document"));
+        }
+    }
+
+    if (!bParsed)
+    {
+        OutErrorMessage = Parser.Error;
+        Nodes.Reset();
+        Strings.Reset();
+    }
+    return bParsed;
+}
+
+TSharedRef<FUnrealMCPJsonDocument> FUnrealMCPJsonDocument::FromJsonObject(const TSharedPtr<FJsonObject>& Object)
+{
+    TSharedRef<FUnrealMCPJsonDocument> Document = MakeShared<FUnrealMCPJsonDocument>();
+    if (Object.IsValid())
+    {
+        TArray<uint8> Bytes;
+        FUnrealMCPJsonWriter(Bytes).WriteJsonObject(Object);
+
+        FString ErrorMessage;
+        Document->Parse(Bytes.GetData(), Bytes.Num(), ErrorMessage);
+    }
+    return Document;
+}
+
+int32 FUnrealMCPJsonDocument::FindDocumentEnd(const uint8* Data, int32 Length, FScanState& State)
+{
+    while (State.Offset < Length)
+    {
+        if (State.bEscape)
+        {
+            State.bEscape = false;
+            ++State.Offset;
+            continue;
+        }
+
+        // Inside a document only quotes, backslashes and brackets matter, so jump straight to the next one
+        if (State.Depth > 0)
+        {
+            State.Offset = FUnrealMCPJsonScanner::FindStructural(Data, State.Offset, Length, State.bInString);
+            if (State.Offset >= Length)
+            {
+                break;
+            }
+        }
+
+        const uint8 Char = Data[State.Offset++];
+        if (State.bInString)
+        {
+            if (Char == '\\')
+            {
+                State.bEscape = true;
+            }
+            else if (Char == '"')
+            {
+                State.bInString = false;
+            }
+            continue;
+        }
+
+        if (State.Depth == 0)
+        {
+            // Between documents only whitespace may precede the opening bracket
+            if (FUnrealMCPJsonParser::IsWhitespace(Char))
+            {
+                continue;
+            }
+            if (Char != '{' && Char != '[')
+            {
+                return -1;
+            }
+        }
+
+        if (Char == '"')
+        {
+            State.bInString = true;
+        }
+        else if (Char == '{' || Char == '[')
+        {
+            ++State.Depth;
+        }
+        else if ((Char == '}' || Char == ']') && --State.Depth == 0)
+        {
+            return State.Offset;
+        }
+    }
+    return 0;
+}
+
+EJson FUnrealMCPJsonView::GetType() const
+{
+    if (!IsValid())
+    {
+        return EJson::None;
+    }
+    return Element != INDEX_NONE ? EJson::Number : Document->Nodes[Index].Type;
+}
+
+int32 FUnrealMCPJsonView::Num() const
+{
+    const EJson Type = GetType();
+    return (Type == EJson::Object || Type == EJson::Array) ? Document->Nodes[Index].Count : 0;
+}
+
+double FUnrealMCPJsonView::AsNumber() const
+{
+    if (IsValid() && Element != INDEX_NONE)
+    {
+        return Document->Floats[Document->Nodes[Index].StringOffset + Element];
+    }
+
+    const EJson Type = GetType();
+    return (Type == EJson::Number || Type == EJson::Boolean) ? Document->Nodes[Index].Number : 0.0;
+}
+
+bool FUnrealMCPJsonView::AsBool() const
+{
+    return AsNumber() != 0.0;
+}
+
+FStringView FUnrealMCPJsonView::AsStringView() const
+{
+    if (GetType() != EJson::String)
+    {
+        return FStringView();
+    }
+
+    const FUnrealMCPJsonDocument::FNode& Node = Document->Nodes[Index];
+    return FStringView(Document->Strings.GetData() + Node.StringOffset, Node.StringLength);
+}
+
+FUnrealMCPJsonView FUnrealMCPJsonView::Find(const TCHAR* Key) const
+{
+    if (!IsObject())
+    {
+        return FUnrealMCPJsonView();
+    }
+
+    const FStringView KeyView(Key);
+    const TArray<FUnrealMCPJsonDocument::FNode>& Nodes = Document->Nodes;
+    int32 Child = Index + 1;
+    for (int32 Field = 0; Field < Nodes[Index].Count; ++Field)
+    {
+        // Each field is a key node followed by the value's subtree
+        if (FUnrealMCPJsonView(Document, Child).AsStringView().Equals(KeyView, ESearchCase::IgnoreCase))
+        {
+            return FUnrealMCPJsonView(Document, Child + 1);
+        }
+        Child = Nodes[Child + 1].Next;
+    }
+    return FUnrealMCPJsonView();
+}
+
+bool FUnrealMCPJsonView::TryGetStringField(const TCHAR* Key, FString& OutValue) const
+{
+    const FUnrealMCPJsonView Value = Find(Key);
+    if (Value.GetType() != EJson::String)
+    {
+        return false;
+    }
+    OutValue = Value.AsString();
+    return true;
+}
+
+bool FUnrealMCPJsonView::TryGetNumberField(const TCHAR* Key, double& OutValue) const
+{
+    const FUnrealMCPJsonView Value = Find(Key);
+    if (Value.GetType() != EJson::Number)
+    {
+        return false;
+    }
+    OutValue = Value.AsNumber();
+    return true;
+}
+
+bool FUnrealMCPJsonView::TryGetNumberField(const TCHAR* Key, int32& OutValue) const
+{
+    double Number = 0.0;
+    if (!TryGetNumberField(Key, Number))
+    {
+        return false;
+    }
+    OutValue = FMath::RoundToInt(Number);
+    return true;
+}
+
+bool FUnrealMCPJsonView::TryGetBoolField(const TCHAR* Key, bool& OutValue) const
+{
+    const FUnrealMCPJsonView Value = Find(Key);
+    if (Value.GetType() != EJson::Boolean)
+    {
+        return false;
+    }
+    OutValue = Value.AsBool();
+    return true;
+}
+
+bool FUnrealMCPJsonView::TryGetArrayField(const TCHAR* Key, FUnrealMCPJsonView& OutValue) const
+{
+    const FUnrealMCPJsonView Value = Find(Key);
+    if (!Value.IsArray())
+    {
+        return false;
+    }
+    OutValue = Value;
+    return true;
+}
+
+bool FUnrealMCPJsonView::TryGetObjectField(const TCHAR* Key, FUnrealMCPJsonView& OutValue) const
+{
+    const FUnrealMCPJsonView Value = Find(Key);
+    if (!Value.IsObject())
+    {
+        return false;
+    }
+    OutValue = Value;
+    return true;
+}
+
+void FUnrealMCPJsonView::ForEachElement(TFunctionRef<void(const FUnrealMCPJsonView&)> Visitor) const
+{
+    if (!IsArray())
+    {
+        return;
+    }
+
+    const TArray<FUnrealMCPJsonDocument::FNode>& Nodes = Document->Nodes;
+    if (Nodes[Index].bPackedFloats)
+    {
+        for (int32 FloatIndex = 0; FloatIndex < Nodes[Index].Count; ++FloatIndex)
+        {
+            Visitor(FUnrealMCPJsonView(Document, Index, FloatIndex));
+        }
+        return;
+    }
+
+    int32 Child = Index + 1;
+    for (int32 ElementIndex = 0; ElementIndex < Nodes[Index].Count; ++ElementIndex)
+    {
+        Visitor(FUnrealMCPJsonView(Document, Child));
+        Child = Nodes[Child].Next;
+    }
+}
+
+bool FUnrealMCPJsonView::TryGetFloatArray(TConstArrayView<float>& OutValues) const
+{
+    if (!IsArray() || !Document->Nodes[Index].bPackedFloats)
+    {
+        return false;
+    }
+
+    const FUnrealMCPJsonDocument::FNode& Node = Document->Nodes[Index];
+    OutValues = TConstArrayView<float>(Document->Floats.GetData() + Node.StringOffset, Node.Count);
+    return true;
+}
+
+void FUnrealMCPJsonView::ForEachField(TFunctionRef<void(FStringView, const FUnrealMCPJsonView&)> Visitor) const
+{
+    if (!IsObject())
+    {
+        return;
+    }
+
+    const TArray<FUnrealMCPJsonDocument::FNode>& Nodes = Document->Nodes;
+    int32 Child = Index + 1;
+    for (int32 Field = 0; Field < Nodes[Index].Count; ++Field)
+    {
+        Visitor(FUnrealMCPJsonView(Document, Child).AsStringView(), FUnrealMCPJsonView(Document, Child + 1));
+        Child = Nodes[Child + 1].Next;
+    }
+}
+
+TSharedPtr<FJsonValue> FUnrealMCPJsonView::ToJsonValue() const
+{
+    switch (GetType())
+    {
+    case EJson::Boolean:
+        return MakeShared<FJsonValueBoolean>(AsBool());
+    case EJson::Number:
+        return MakeShared<FJsonValueNumber>(AsNumber());
+    case EJson::String:
+        return MakeShared<FJsonValueString>(AsString());
+    case EJson::Array:
+    {
+        TArray<TSharedPtr<FJsonValue>> Values;
+        Values.Reserve(Num());
+        ForEachElement([&Values](const FUnrealMCPJsonView& Element)
+        {
+            Values.Add(Element.ToJsonValue());
+        });
+        return MakeShared<FJsonValueArray>(Values);
+    }
+    case EJson::Object:
+        return MakeShared<FJsonValueObject>(ToJsonObject());
+    case EJson::Null:
+        return MakeShared<FJsonValueNull>();
+    default:
+        return nullptr;
+    }
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPJsonView::ToJsonObject() const
+{
+    if (!IsObject())
+    {
+        return nullptr;
+    }
+
+    TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+    ForEachField([&Object](FStringView Key, const FUnrealMCPJsonView& Value)
+    {
+        Object->SetField(FString(Key), Value.ToJsonValue());
+    });
+    return Object;
+}
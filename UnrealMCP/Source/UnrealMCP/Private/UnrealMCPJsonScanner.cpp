@@ -0,0 +1,228 @@
+#include "UnrealMCPJsonScanner.h"
+#include "HAL/IConsoleManager.h"
+
+#define UNREALMCP_JSON_SSE2 (PLATFORM_CPU_X86_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS)
+#define UNREALMCP_JSON_AVX2 (UNREALMCP_JSON_SSE2 && PLATFORM_ALWAYS_HAS_AVX_2)
+#define UNREALMCP_JSON_NEON (!UNREALMCP_JSON_SSE2 && PLATFORM_ENABLE_VECTORINTRINSICS_NEON)
+
+#if UNREALMCP_JSON_SSE2
+#include <immintrin.h>
+#elif UNREALMCP_JSON_NEON
+#include <arm_neon.h>
+#endif
+
+static TAutoConsoleVariable<bool> CVarJsonVectorized(
+    TEXT("UnrealMCP.Json.Vectorized"),
+    true,
+    TEXT("Use SIMD scanners when parsing MCP requests. Disable to compare against the scalar path."));
+
+int32 FUnrealMCPJsonScanner::FindStringSpecialScalar(const uint8* Data, int32 Pos, int32 Length)
+{
+    while (Pos < Length && Data[Pos] >= 0x20 && Data[Pos] < 0x80 && Data[Pos] != '"' && Data[Pos] != '\\')
+    {
+        ++Pos;
+    }
+    return Pos;
+}
+
+int32 FUnrealMCPJsonScanner::FindStructuralScalar(const uint8* Data, int32 Pos, int32 Length, bool bInString)
+{
+    for (; Pos < Length; ++Pos)
+    {
+        const uint8 Char = Data[Pos];
+        if (Char == '"' || (bInString ? Char == '\\' : (Char == '{' || Char == '}' || Char == '[' || Char == ']')))
+        {
+            break;
+        }
+    }
+    return Pos;
+}
+
+bool FUnrealMCPJsonScanner::IsVectorized()
+{
+#if UNREALMCP_JSON_SSE2 || UNREALMCP_JSON_NEON
+    return CVarJsonVectorized.GetValueOnAnyThread();
+#else
+    return false;
+#endif
+}
+
+const TCHAR* FUnrealMCPJsonScanner::GetInstructionSetName()
+{
+#if UNREALMCP_JSON_AVX2
+    return TEXT("AVX2");
+#elif UNREALMCP_JSON_SSE2
+    return TEXT("SSE2");
+#elif UNREALMCP_JSON_NEON
+    return TEXT("NEON");
+#else
+    return TEXT("Scalar");
+#endif
+}
+
+int32 FUnrealMCPJsonScanner::FindStringSpecial(const uint8* Data, int32 Start, int32 Length)
+{
+    int32 Pos = Start;
+    if (!IsVectorized())
+    {
+        return FindStringSpecialScalar(Data, Pos, Length);
+    }
+
+    // Signed compare against 0x20 flags control characters and, since they are negative, bytes >= 0x80
+#if UNREALMCP_JSON_AVX2
+    {
+        const __m256i Quote = _mm256_set1_epi8('"');
+        const __m256i Backslash = _mm256_set1_epi8('\\');
+        const __m256i Space = _mm256_set1_epi8(0x20);
+        for (; Pos + 32 <= Length; Pos += 32)
+        {
+            const __m256i Chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Data + Pos));
+            const __m256i Special = _mm256_or_si256(
+                _mm256_or_si256(_mm256_cmpeq_epi8(Chunk, Quote), _mm256_cmpeq_epi8(Chunk, Backslash)),
+                _mm256_cmpgt_epi8(Space, Chunk));
+            const uint32 Mask = (uint32)_mm256_movemask_epi8(Special);
+            if (Mask != 0)
+            {
+                return Pos + (int32)FMath::CountTrailingZeros(Mask);
+            }
+        }
+    }
+#endif
+
+#if UNREALMCP_JSON_SSE2
+    {
+        const __m128i Quote = _mm_set1_epi8('"');
+        const __m128i Backslash = _mm_set1_epi8('\\');
+        const __m128i Space = _mm_set1_epi8(0x20);
+        for (; Pos + 16 <= Length; Pos += 16)
+        {
+            const __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + Pos));
+            const __m128i Special = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(Chunk, Quote), _mm_cmpeq_epi8(Chunk, Backslash)),
+                _mm_cmplt_epi8(Chunk, Space));
+            const uint32 Mask = (uint32)_mm_movemask_epi8(Special);
+            if (Mask != 0)
+            {
+                return Pos + (int32)FMath::CountTrailingZeros(Mask);
+            }
+        }
+    }
+#elif UNREALMCP_JSON_NEON
+    {
+        const uint8x16_t Quote = vdupq_n_u8('"');
+        const uint8x16_t Backslash = vdupq_n_u8('\\');
+        const uint8x16_t Space = vdupq_n_u8(0x20);
+        const uint8x16_t HighBit = vdupq_n_u8(0x80);
+        for (; Pos + 16 <= Length; Pos += 16)
+        {
+            const uint8x16_t Chunk = vld1q_u8(Data + Pos);
+            const uint8x16_t Special = vorrq_u8(
+                vorrq_u8(vceqq_u8(Chunk, Quote), vceqq_u8(Chunk, Backslash)),
+                vorrq_u8(vcltq_u8(Chunk, Space), vcgeq_u8(Chunk, HighBit)));
+            if (vmaxvq_u8(Special) != 0)
+            {
+                // NEON has no movemask; the hit is inside this block, so finish it byte by byte
+                return FindStringSpecialScalar(Data, Pos, Pos + 16);
+            }
+        }
+    }
+#endif
+
+    return FindStringSpecialScalar(Data, Pos, Length);
+}
+
+int32 FUnrealMCPJsonScanner::FindStructural(const uint8* Data, int32 Start, int32 Length, bool bInString)
+{
+    int32 Pos = Start;
+    if (!IsVectorized())
+    {
+        return FindStructuralScalar(Data, Pos, Length, bInString);
+    }
+
+    // Outside strings, OR-ing in 0x20 folds '[' onto '{' and ']' onto '}', so two compares cover all four brackets
+#if UNREALMCP_JSON_AVX2
+    {
+        const __m256i Quote = _mm256_set1_epi8('"');
+        const __m256i Backslash = _mm256_set1_epi8('\\');
+        const __m256i CaseBit = _mm256_set1_epi8(0x20);
+        const __m256i OpenBrace = _mm256_set1_epi8('{');
+        const __m256i CloseBrace = _mm256_set1_epi8('}');
+        for (; Pos + 32 <= Length; Pos += 32)
+        {
+            const __m256i Chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Data + Pos));
+            __m256i Hits = _mm256_cmpeq_epi8(Chunk, Quote);
+            if (bInString)
+            {
+                Hits = _mm256_or_si256(Hits, _mm256_cmpeq_epi8(Chunk, Backslash));
+            }
+            else
+            {
+                const __m256i Folded = _mm256_or_si256(Chunk, CaseBit);
+                Hits = _mm256_or_si256(Hits, _mm256_or_si256(_mm256_cmpeq_epi8(Folded, OpenBrace), _mm256_cmpeq_epi8(Folded, CloseBrace)));
+            }
+            const uint32 Mask = (uint32)_mm256_movemask_epi8(Hits);
+            if (Mask != 0)
+            {
+                return Pos + (int32)FMath::CountTrailingZeros(Mask);
+            }
+        }
+    }
+#endif
+
+#if UNREALMCP_JSON_SSE2
+    {
+        const __m128i Quote = _mm_set1_epi8('"');
+        const __m128i Backslash = _mm_set1_epi8('\\');
+        const __m128i CaseBit = _mm_set1_epi8(0x20);
+        const __m128i OpenBrace = _mm_set1_epi8('{');
+        const __m128i CloseBrace = _mm_set1_epi8('}');
+        for (; Pos + 16 <= Length; Pos += 16)
+        {
+            const __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + Pos));
+            __m128i Hits = _mm_cmpeq_epi8(Chunk, Quote);
+            if (bInString)
+            {
+                Hits = _mm_or_si128(Hits, _mm_cmpeq_epi8(Chunk, Backslash));
+            }
+            else
+            {
+                const __m128i Folded = _mm_or_si128(Chunk, CaseBit);
+                Hits = _mm_or_si128(Hits, _mm_or_si128(_mm_cmpeq_epi8(Folded, OpenBrace), _mm_cmpeq_epi8(Folded, CloseBrace)));
+            }
+            const uint32 Mask = (uint32)_mm_movemask_epi8(Hits);
+            if (Mask != 0)
+            {
+                return Pos + (int32)FMath::CountTrailingZeros(Mask);
+            }
+        }
+    }
+#elif UNREALMCP_JSON_NEON
+    {
+        const uint8x16_t Quote = vdupq_n_u8('"');
+        const uint8x16_t Backslash = vdupq_n_u8('\\');
+        const uint8x16_t CaseBit = vdupq_n_u8(0x20);
+        const uint8x16_t OpenBrace = vdupq_n_u8('{');
+        const uint8x16_t CloseBrace = vdupq_n_u8('}');
+        for (; Pos + 16 <= Length; Pos += 16)
+        {
+            const uint8x16_t Chunk = vld1q_u8(Data + Pos);
+            uint8x16_t Hits = vceqq_u8(Chunk, Quote);
+            if (bInString)
+            {
+                Hits = vorrq_u8(Hits, vceqq_u8(Chunk, Backslash));
+            }
+            else
+            {
+                const uint8x16_t Folded = vorrq_u8(Chunk, CaseBit);
+                Hits = vorrq_u8(Hits, vorrq_u8(vceqq_u8(Folded, OpenBrace), vceqq_u8(Folded, CloseBrace)));
+            }
+            if (vmaxvq_u8(Hits) != 0)
+            {
+                return FindStructuralScalar(Data, Pos, Pos + 16, bInString);
+            }
+        }
+    }
+#endif
+
+    return FindStructuralScalar(Data, Pos, Length, bInString);
+}
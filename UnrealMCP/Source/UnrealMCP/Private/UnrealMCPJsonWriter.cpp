@@ -0,0 +1,320 @@
+#include "UnrealMCPJsonWriter.h"
+#include "Misc/Base64.h"
+
+FUnrealMCPJsonWriter::FUnrealMCPJsonWriter(TArray<uint8>& InBuffer)
+    : Buffer(InBuffer)
+    , bAfterKey(false)
+{
+}
+
+void FUnrealMCPJsonWriter::BeginObject()
+{
+    WriteSeparator();
+    Append('{');
+    HasValue.Push(false);
+}
+
+void FUnrealMCPJsonWriter::EndObject()
+{
+    HasValue.Pop(EAllowShrinking::No);
+    Append('}');
+}
+
+void FUnrealMCPJsonWriter::BeginArray()
+{
+    WriteSeparator();
+    Append('[');
+    HasValue.Push(false);
+}
+
+void FUnrealMCPJsonWriter::EndArray()
+{
+    HasValue.Pop(EAllowShrinking::No);
+    Append(']');
+}
+
+void FUnrealMCPJsonWriter::WriteKey(const TCHAR* Key)
+{
+    WriteSeparator();
+    Append('"');
+    WriteEscaped(Key, FCString::Strlen(Key));
+    Append("\":", 2);
+    bAfterKey = true;
+}
+
+void FUnrealMCPJsonWriter::WriteKey(const FString& Key)
+{
+    WriteSeparator();
+    Append('"');
+    WriteEscaped(*Key, Key.Len());
+    Append("\":", 2);
+    bAfterKey = true;
+}
+
+void FUnrealMCPJsonWriter::WriteString(const TCHAR* Value)
+{
+    WriteSeparator();
+    Append('"');
+    WriteEscaped(Value, FCString::Strlen(Value));
+    Append('"');
+}
+
+void FUnrealMCPJsonWriter::WriteString(const FString& Value)
+{
+    WriteSeparator();
+    Append('"');
+    WriteEscaped(*Value, Value.Len());
+    Append('"');
+}
+
+void FUnrealMCPJsonWriter::WriteNumber(double Value)
+{
+    WriteSeparator();
+
+    // JSON has no NaN or infinity
+    if (!FMath::IsFinite(Value))
+    {
+        Append("null", 4);
+        return;
+    }
+
+    ANSICHAR Text[32];
+    int32 Length;
+    if (Value == FMath::FloorToDouble(Value) && FMath::Abs(Value) < 1e15)
+    {
+        Length = FCStringAnsi::Snprintf(Text, sizeof(Text), "%lld", static_cast<long long>(Value));
+    }
+    else
+    {
+        // Shortest of 15 or 17 significant digits that reads back to the same double
+        Length = FCStringAnsi::Snprintf(Text, sizeof(Text), "%.15g", Value);
+        if (FCStringAnsi::Atod(Text) != Value)
+        {
+            Length = FCStringAnsi::Snprintf(Text, sizeof(Text), "%.17g", Value);
+        }
+    }
+    Append(Text, Length);
+}
+
+void FUnrealMCPJsonWriter::WriteInt(int64 Value)
+{
+    WriteSeparator();
+    ANSICHAR Text[24];
+    const int32 Length = FCStringAnsi::Snprintf(Text, sizeof(Text), "%lld", static_cast<long long>(Value));
+    Append(Text, Length);
+}
+
+void FUnrealMCPJsonWriter::WriteBool(bool Value)
+{
+    WriteSeparator();
+    if (Value)
+    {
+        Append("true", 4);
+    }
+    else
+    {
+        Append("false", 5);
+    }
+}
+
+void FUnrealMCPJsonWriter::WriteNull()
+{
+    WriteSeparator();
+    Append("null", 4);
+}
+
+void FUnrealMCPJsonWriter::WriteFloatArray(TConstArrayView<float> Values, bool bBase64)
+{
+    if (bBase64)
+    {
+        WriteString(FBase64::Encode(reinterpret_cast<const uint8*>(Values.GetData()), Values.Num() * sizeof(float)));
+        return;
+    }
+
+    BeginArray();
+    for (const float Value : Values)
+    {
+        if (!FMath::IsFinite(Value) || Value == FMath::FloorToFloat(Value))
+        {
+            WriteNumber(Value);
+            continue;
+        }
+
+        // Shortest of 7 or 9 significant digits that reads back to the same float, so values
+        // do not pick up the float-to-double noise a double formatter would print
+        WriteSeparator();
+        ANSICHAR Text[32];
+        int32 Length = FCStringAnsi::Snprintf(Text, sizeof(Text), "%.7g", Value);
+        if ((float)FCStringAnsi::Atod(Text) != Value)
+        {
+            Length = FCStringAnsi::Snprintf(Text, sizeof(Text), "%.9g", Value);
+        }
+        Append(Text, Length);
+    }
+    EndArray();
+}
+
+void FUnrealMCPJsonWriter::WriteBinary(TConstArrayView<uint8> Bytes)
+{
+    WriteString(FBase64::Encode(Bytes.GetData(), Bytes.Num()));
+}
+
+void FUnrealMCPJsonWriter::WriteVector(const FVector& Value)
+{
+    BeginArray();
+    WriteNumber(Value.X);
+    WriteNumber(Value.Y);
+    WriteNumber(Value.Z);
+    EndArray();
+}
+
+void FUnrealMCPJsonWriter::WriteRotator(const FRotator& Value)
+{
+    BeginArray();
+    WriteNumber(Value.Pitch);
+    WriteNumber(Value.Yaw);
+    WriteNumber(Value.Roll);
+    EndArray();
+}
+
+void FUnrealMCPJsonWriter::WriteJsonValue(const TSharedPtr<FJsonValue>& Value)
+{
+    if (!Value.IsValid())
+    {
+        WriteNull();
+        return;
+    }
+
+    switch (Value->Type)
+    {
+    case EJson::String:
+        WriteString(Value->AsString());
+        break;
+    case EJson::Number:
+        WriteNumber(Value->AsNumber());
+        break;
+    case EJson::Boolean:
+        WriteBool(Value->AsBool());
+        break;
+    case EJson::Array:
+        BeginArray();
+        for (const TSharedPtr<FJsonValue>& Element : Value->AsArray())
+        {
+            WriteJsonValue(Element);
+        }
+        EndArray();
+        break;
+    case EJson::Object:
+        WriteJsonObject(Value->AsObject());
+        break;
+    default:
+        WriteNull();
+        break;
+    }
+}
+
+void FUnrealMCPJsonWriter::WriteJsonObject(const TSharedPtr<FJsonObject>& Object)
+{
+    if (!Object.IsValid())
+    {
+        WriteNull();
+        return;
+    }
+
+    BeginObject();
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Object->Values)
+    {
+        WriteKey(Field.Key);
+        WriteJsonValue(Field.Value);
+    }
+    EndObject();
+}
+
+void FUnrealMCPJsonWriter::WriteSeparator()
+{
+    if (bAfterKey)
+    {
+        bAfterKey = false;
+        return;
+    }
+
+    if (HasValue.Num() > 0)
+    {
+        if (HasValue.Last())
+        {
+            Append(',');
+        }
+        HasValue.Last() = true;
+    }
+}
+
+void FUnrealMCPJsonWriter::WriteEscaped(const TCHAR* Value, int32 Length)
+{
+    for (int32 Index = 0; Index < Length; ++Index)
+    {
+        uint32 CodePoint = static_cast<uint32>(Value[Index]);
+
+        // Plain ASCII is by far the common case
+        if (CodePoint >= 0x20 && CodePoint < 0x80 && CodePoint != '"' && CodePoint != '\\')
+        {
+            Append(static_cast<ANSICHAR>(CodePoint));
+            continue;
+        }
+
+        switch (CodePoint)
+        {
+        case '"':  Append("\\\"", 2); continue;
+        case '\\': Append("\\\\", 2); continue;
+        case '\n': Append("\\n", 2); continue;
+        case '\r': Append("\\r", 2); continue;
+        case '\t': Append("\\t", 2); continue;
+        case '\b': Append("\\b", 2); continue;
+        case '\f': Append("\\f", 2); continue;
+        default: break;
+        }
+
+        if (CodePoint < 0x20)
+        {
+            ANSICHAR Escape[8];
+            const int32 EscapeLength = FCStringAnsi::Snprintf(Escape, sizeof(Escape), "\\u%04x", CodePoint);
+            Append(Escape, EscapeLength);
+            continue;
+        }
+
+        // Combine UTF-16 surrogate pairs; lone surrogates become U+FFFD
+        if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF && Index + 1 < Length &&
+            static_cast<uint32>(Value[Index + 1]) >= 0xDC00 && static_cast<uint32>(Value[Index + 1]) <= 0xDFFF)
+        {
+            CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (static_cast<uint32>(Value[Index + 1]) - 0xDC00);
+            ++Index;
+        }
+        else if (CodePoint >= 0xD800 && CodePoint <= 0xDFFF)
+        {
+            CodePoint = 0xFFFD;
+        }
+
+        if (CodePoint < 0x800)
+        {
+            Append(static_cast<ANSICHAR>(0xC0 | (CodePoint >> 6)));
+            Append(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+        }
+        else if (CodePoint < 0x10000)
+        {
+            Append(static_cast<ANSICHAR>(0xE0 | (CodePoint >> 12)));
+            Append(static_cast<ANSICHAR>(0x80 | ((CodePoint >> 6) & 0x3F)));
+            Append(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+        }
+        else
+        {
+            Append(static_cast<ANSICHAR>(0xF0 | (CodePoint >> 18)));
+            Append(static_cast<ANSICHAR>(0x80 | ((CodePoint >> 12) & 0x3F)));
+            Append(static_cast<ANSICHAR>(0x80 | ((CodePoint >> 6) & 0x3F)));
+            Append(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+        }
+    }
+}
+
+void FUnrealMCPJsonWriter::Append(const ANSICHAR* Data, int32 Length)
+{
+    Buffer.Append(reinterpret_cast<const uint8*>(Data), Length);
+}
@@ -0,0 +1,195 @@
+#include "UnrealMCPLevelSnapshot.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Misc/FileHelper.h"
+
+// Sanity limits so a corrupt header cannot trigger huge allocations
+const uint32 MaxSnapshotStringBytes = 64 * 1024;
+
+int32 FUnrealMCPLevelSnapshot::AddString(const FString& String)
+{
+    if (const int32* Existing = StringIndices.Find(String))
+    {
+        return *Existing;
+    }
+
+    const int32 Index = Strings.Add(String);
+    StringIndices.Add(String, Index);
+    return Index;
+}
+
+const FString& FUnrealMCPLevelSnapshot::GetString(int32 Index) const
+{
+    static const FString Empty;
+    return Strings.IsValidIndex(Index) ? Strings[Index] : Empty;
+}
+
+void FUnrealMCPLevelSnapshot::Write(TArray<uint8>& OutBytes) const
+{
+    OutBytes.Reset();
+    FMemoryWriter Writer(OutBytes);
+
+    // The level name is stored in the string table, appended if no actor already uses it
+    const int32* ExistingLevelName = StringIndices.Find(LevelName);
+    uint32 LevelNameIndex = ExistingLevelName ? static_cast<uint32>(*ExistingLevelName) : static_cast<uint32>(Strings.Num());
+
+    uint32 MagicValue = Magic;
+    uint16 VersionValue = Version;
+    uint16 Flags = 0;
+    Writer << MagicValue << VersionValue << Flags;
+
+    uint32 StringCount = Strings.Num() + (ExistingLevelName ? 0 : 1);
+    Writer << StringCount;
+    for (uint32 Index = 0; Index < StringCount; ++Index)
+    {
+        FTCHARToUTF8 Utf8(Index < static_cast<uint32>(Strings.Num()) ? *Strings[Index] : *LevelName);
+        uint32 ByteLength = Utf8.Length();
+        Writer << ByteLength;
+        Writer.Serialize(const_cast<ANSICHAR*>(Utf8.Get()), ByteLength);
+    }
+
+    Writer << LevelNameIndex;
+
+    uint32 ActorCount = Actors.Num();
+    Writer << ActorCount;
+
+    // Fixed size records: 5 string indices followed by 9 floats
+    OutBytes.Reserve(OutBytes.Num() + Actors.Num() * 56);
+    for (const FUnrealMCPSnapshotActor& Actor : Actors)
+    {
+        uint32 Indices[5] = {
+            static_cast<uint32>(Actor.NameIndex),
+            static_cast<uint32>(Actor.LabelIndex),
+            static_cast<uint32>(Actor.ClassIndex),
+            static_cast<uint32>(Actor.FolderIndex),
+            static_cast<uint32>(Actor.ParentIndex)
+        };
+        for (uint32& Value : Indices)
+        {
+            Writer << Value;
+        }
+
+        float Floats[9] = {
+            Actor.Location.X, Actor.Location.Y, Actor.Location.Z,
+            Actor.Rotation.Pitch, Actor.Rotation.Yaw, Actor.Rotation.Roll,
+            Actor.Scale.X, Actor.Scale.Y, Actor.Scale.Z
+        };
+        for (float& Value : Floats)
+        {
+            Writer << Value;
+        }
+    }
+}
+
+bool FUnrealMCPLevelSnapshot::Read(const TArray<uint8>& Bytes, FString& OutErrorMessage)
+{
+    LevelName.Reset();
+    Strings.Reset();
+    Actors.Reset();
+    StringIndices.Reset();
+
+    FMemoryReader Reader(Bytes);
+
+    uint32 MagicValue = 0;
+    uint16 VersionValue = 0;
+    uint16 Flags = 0;
+    Reader << MagicValue << VersionValue << Flags;
+    if (Reader.IsError() || MagicValue != Magic)
+    {
+        OutErrorMessage = TEXT("Not a level snapshot");
+        return false;
+    }
+    if (VersionValue > Version)
+    {
+        OutErrorMessage = FString::Printf(TEXT("Unsupported snapshot version %d (reader supports up to %d)"), VersionValue, Version);
+        return false;
+    }
+
+    uint32 StringCount = 0;
+    Reader << StringCount;
+    if (Reader.IsError() || StringCount > static_cast<uint32>(Bytes.Num() / sizeof(uint32)))
+    {
+        OutErrorMessage = TEXT("Corrupt string table");
+        return false;
+    }
+
+    Strings.Reserve(StringCount);
+    TArray<ANSICHAR> Utf8;
+    for (uint32 Index = 0; Index < StringCount; ++Index)
+    {
+        uint32 ByteLength = 0;
+        Reader << ByteLength;
+        if (Reader.IsError() || ByteLength > MaxSnapshotStringBytes || Reader.Tell() + ByteLength > Reader.TotalSize())
+        {
+            OutErrorMessage = FString::Printf(TEXT("Corrupt string %d in string table"), Index);
+            return false;
+        }
+
+        Utf8.SetNumUninitialized(ByteLength);
+        Reader.Serialize(Utf8.GetData(), ByteLength);
+
+        // Append rather than AddString: records refer to file positions, so a repeated string must keep its own slot
+        const int32 StringIndex = Strings.Add(FString(FUTF8ToTCHAR(Utf8.GetData(), ByteLength)));
+        StringIndices.FindOrAdd(Strings[StringIndex], StringIndex);
+    }
+
+    uint32 LevelNameIndex = 0;
+    uint32 ActorCount = 0;
+    Reader << LevelNameIndex << ActorCount;
+    if (Reader.IsError() || Reader.Tell() + static_cast<int64>(ActorCount) * 56 > Reader.TotalSize())
+    {
+        OutErrorMessage = TEXT("Truncated actor records");
+        return false;
+    }
+    LevelName = GetString(static_cast<int32>(LevelNameIndex));
+
+    Actors.SetNum(ActorCount);
+    for (FUnrealMCPSnapshotActor& Actor : Actors)
+    {
+        uint32 Indices[5];
+        for (uint32& Value : Indices)
+        {
+            Reader << Value;
+        }
+
+        float Floats[9];
+        for (float& Value : Floats)
+        {
+            Reader << Value;
+        }
+
+        Actor.NameIndex = static_cast<int32>(Indices[0]);
+        Actor.LabelIndex = static_cast<int32>(Indices[1]);
+        Actor.ClassIndex = static_cast<int32>(Indices[2]);
+        Actor.FolderIndex = static_cast<int32>(Indices[3]);
+        Actor.ParentIndex = static_cast<int32>(Indices[4]);
+        Actor.Location = FVector3f(Floats[0], Floats[1], Floats[2]);
+        Actor.Rotation = FRotator3f(Floats[3], Floats[4], Floats[5]);
+        Actor.Scale = FVector3f(Floats[6], Floats[7], Floats[8]);
+    }
+
+    if (Reader.IsError())
+    {
+        OutErrorMessage = TEXT("Failed to read actor records");
+        return false;
+    }
+    return true;
+}
+
+bool FUnrealMCPLevelSnapshot::SaveToFile(const FString& FilePath) const
+{
+    TArray<uint8> Bytes;
+    Write(Bytes);
+    return FFileHelper::SaveArrayToFile(Bytes, *FilePath);
+}
+
+bool FUnrealMCPLevelSnapshot::LoadFromFile(const FString& FilePath, FString& OutErrorMessage)
+{
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *FilePath))
+    {
+        OutErrorMessage = FString::Printf(TEXT("Failed to read file: %s"), *FilePath);
+        return false;
+    }
+    return Read(Bytes, OutErrorMessage);
+}
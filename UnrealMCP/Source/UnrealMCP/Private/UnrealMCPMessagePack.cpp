@@ -0,0 +1,515 @@
+#include "UnrealMCPJsonDocument.h"
+#include "UnrealMCPMessagePackWriter.h"
+#include "Misc/Base64.h"
+
+// Same nesting limit as the JSON parser
+const int32 MaxMessagePackDepth = 512;
+
+/**
+ * MessagePack decoder writing into an FUnrealMCPJsonDocument tape, so handlers read
+ * MessagePack requests through the same views as JSON ones. The mapping is one-to-one
+ * with JSON: maps become objects (keys must be strings), bin becomes a base64 string
+ * (the encoding the JSON schema already uses for binary fields), and the float array
+ * extension becomes a packed array readable without per-element decoding.
+ */
+struct FUnrealMCPMessagePackParser
+{
+    FUnrealMCPMessagePackParser(FUnrealMCPJsonDocument& InDocument, const uint8* InData, int32 InLength)
+        : Document(InDocument)
+        , Data(InData)
+        , Length(InLength)
+    {
+    }
+
+    FUnrealMCPJsonDocument& Document;
+    const uint8* Data;
+    int32 Length;
+    int32 Pos = 0;
+    FString Error;
+
+    bool Fail(const TCHAR* Message)
+    {
+        Error = FString::Printf(TEXT("%s at byte %d"), Message, Pos);
+        return false;
+    }
+
+    bool Has(int64 Bytes) const
+    {
+        return Bytes >= 0 && Pos + Bytes <= Length;
+    }
+
+    // MessagePack stores multi-byte values big-endian
+    uint64 ReadBigEndian(int32 Bytes)
+    {
+        uint64 Value = 0;
+        for (int32 Index = 0; Index < Bytes; ++Index)
+        {
+            Value = (Value << 8) | Data[Pos++];
+        }
+        return Value;
+    }
+
+    int32 AddNode(EJson Type)
+    {
+        const int32 NodeIndex = Document.Nodes.AddDefaulted();
+        FUnrealMCPJsonDocument::FNode& Node = Document.Nodes[NodeIndex];
+        Node.Type = Type;
+        Node.Next = NodeIndex + 1;
+        return NodeIndex;
+    }
+
+    bool AddNumber(double Value)
+    {
+        Document.Nodes[AddNode(EJson::Number)].Number = Value;
+        return true;
+    }
+
+    void AddStringNode(const TCHAR* Chars, int32 CharCount)
+    {
+        const int32 NodeIndex = AddNode(EJson::String);
+        FUnrealMCPJsonDocument::FNode& Node = Document.Nodes[NodeIndex];
+        Node.StringOffset = Document.Strings.Num();
+        Node.StringLength = CharCount;
+        Document.Strings.Append(Chars, CharCount);
+    }
+
+    bool ParseString(int64 ByteCount)
+    {
+        if (!Has(ByteCount))
+        {
+            return Fail(TEXT("Truncated string"));
+        }
+
+        FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Data + Pos), (int32)ByteCount);
+        AddStringNode(Converted.Get(), Converted.Length());
+        Pos += (int32)ByteCount;
+        return true;
+    }
+
+    bool ParseBinary(int64 ByteCount)
+    {
+        if (!Has(ByteCount))
+        {
+            return Fail(TEXT("Truncated binary"));
+        }
+
+        const FString Encoded = FBase64::Encode(Data + Pos, (uint32)ByteCount);
+        AddStringNode(*Encoded, Encoded.Len());
+        Pos += (int32)ByteCount;
+        return true;
+    }
+
+    bool ParseExtension(int64 ByteCount)
+    {
+        if (!Has(1 + ByteCount))
+        {
+            return Fail(TEXT("Truncated extension"));
+        }
+
+        const int8 ExtensionType = (int8)Data[Pos++];
+        if (ExtensionType != FUnrealMCPJsonDocument::MessagePackFloatArrayType)
+        {
+            return Fail(TEXT("Unsupported extension type"));
+        }
+        if (ByteCount % sizeof(float) != 0)
+        {
+            return Fail(TEXT("Float array extension length is not a multiple of 4"));
+        }
+
+        // One copy into the float arena; elements are never decoded individually.
+        // Every platform the editor runs on is little-endian, matching the wire format.
+        const int32 Count = (int32)(ByteCount / sizeof(float));
+        const int32 NodeIndex = AddNode(EJson::Array);
+        FUnrealMCPJsonDocument::FNode& Node = Document.Nodes[NodeIndex];
+        Node.bPackedFloats = true;
+        Node.Count = Count;
+        Node.StringOffset = Document.Floats.AddUninitialized(Count);
+        FMemory::Memcpy(Document.Floats.GetData() + Node.StringOffset, Data + Pos, ByteCount);
+        Pos += (int32)ByteCount;
+        return true;
+    }
+
+    bool ParseContainer(int32 Depth, int64 Count, bool bMap)
+    {
+        if (Depth >= MaxMessagePackDepth)
+        {
+            return Fail(TEXT("Nesting too deep"));
+        }
+        // Every element takes at least one byte, which bounds hostile counts
+        if (!Has(bMap ? Count * 2 : Count))
+        {
+            return Fail(TEXT("Container count exceeds remaining data"));
+        }
+
+        const int32 NodeIndex = AddNode(bMap ? EJson::Object : EJson::Array);
+        for (int64 Element = 0; Element < Count; ++Element)
+        {
+            if (bMap)
+            {
+                // Keys are stored as string nodes immediately before their value, as in JSON documents
+                const int32 KeyNode = Document.Nodes.Num();
+                if (!ParseValue(Depth + 1))
+                {
+                    return false;
+                }
+                if (Document.Nodes[KeyNode].Type != EJson::String)
+                {
+                    return Fail(TEXT("Map keys must be strings"));
+                }
+            }
+            if (!ParseValue(Depth + 1))
+            {
+                return false;
+            }
+        }
+
+        FUnrealMCPJsonDocument::FNode& Node = Document.Nodes[NodeIndex];
+        Node.Count = (int32)Count;
+        Node.Next = Document.Nodes.Num();
+        return true;
+    }
+
+    bool ParseValue(int32 Depth)
+    {
+        if (!Has(1))
+        {
+            return Fail(TEXT("Unexpected end of input"));
+        }
+
+        const uint8 Tag = Data[Pos++];
+        if (Tag <= 0x7F)
+        {
+            return AddNumber(Tag);
+        }
+        if (Tag >= 0xE0)
+        {
+            return AddNumber((int8)Tag);
+        }
+        if (Tag >= 0x80 && Tag <= 0x8F)
+        {
+            return ParseContainer(Depth, Tag & 0x0F, true);
+        }
+        if (Tag >= 0x90 && Tag <= 0x9F)
+        {
+            return ParseContainer(Depth, Tag & 0x0F, false);
+        }
+        if (Tag >= 0xA0 && Tag <= 0xBF)
+        {
+            return ParseString(Tag & 0x1F);
+        }
+
+        // Size of the length or value field that follows each remaining tag
+        auto ReadLength = [this](int32 Bytes, int64& OutLength)
+        {
+            if (!Has(Bytes))
+            {
+                return Fail(TEXT("Truncated length"));
+            }
+            OutLength = (int64)ReadBigEndian(Bytes);
+            return true;
+        };
+
+        int64 Size = 0;
+        switch (Tag)
+        {
+        case 0xC0:
+            AddNode(EJson::Null);
+            return true;
+        case 0xC2:
+        case 0xC3:
+            Document.Nodes[AddNode(EJson::Boolean)].Number = Tag == 0xC3 ? 1.0 : 0.0;
+            return true;
+        case 0xC4: return ReadLength(1, Size) && ParseBinary(Size);
+        case 0xC5: return ReadLength(2, Size) && ParseBinary(Size);
+        case 0xC6: return ReadLength(4, Size) && ParseBinary(Size);
+        case 0xC7: return ReadLength(1, Size) && ParseExtension(Size);
+        case 0xC8: return ReadLength(2, Size) && ParseExtension(Size);
+        case 0xC9: return ReadLength(4, Size) && ParseExtension(Size);
+        case 0xCA:
+        {
+            if (!Has(4))
+            {
+                return Fail(TEXT("Truncated float32"));
+            }
+            const uint32 Bits = (uint32)ReadBigEndian(4);
+            float Value;
+            FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+            return AddNumber(Value);
+        }
+        case 0xCB:
+        {
+            if (!Has(8))
+            {
+                return Fail(TEXT("Truncated float64"));
+            }
+            const uint64 Bits = ReadBigEndian(8);
+            double Value;
+            FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+            return AddNumber(Value);
+        }
+        case 0xCC: return Has(1) ? AddNumber((double)ReadBigEndian(1)) : Fail(TEXT("Truncated uint8"));
+        case 0xCD: return Has(2) ? AddNumber((double)ReadBigEndian(2)) : Fail(TEXT("Truncated uint16"));
+        case 0xCE: return Has(4) ? AddNumber((double)ReadBigEndian(4)) : Fail(TEXT("Truncated uint32"));
+        case 0xCF: return Has(8) ? AddNumber((double)ReadBigEndian(8)) : Fail(TEXT("Truncated uint64"));
+        case 0xD0: return Has(1) ? AddNumber((int8)ReadBigEndian(1)) : Fail(TEXT("Truncated int8"));
+        case 0xD1: return Has(2) ? AddNumber((int16)ReadBigEndian(2)) : Fail(TEXT("Truncated int16"));
+        case 0xD2: return Has(4) ? AddNumber((int32)ReadBigEndian(4)) : Fail(TEXT("Truncated int32"));
+        case 0xD3: return Has(8) ? AddNumber((double)(int64)ReadBigEndian(8)) : Fail(TEXT("Truncated int64"));
+        case 0xD4: return ParseExtension(1);
+        case 0xD5: return ParseExtension(2);
+        case 0xD6: return ParseExtension(4);
+        case 0xD7: return ParseExtension(8);
+        case 0xD8: return ParseExtension(16);
+        case 0xD9: return ReadLength(1, Size) && ParseString(Size);
+        case 0xDA: return ReadLength(2, Size) && ParseString(Size);
+        case 0xDB: return ReadLength(4, Size) && ParseString(Size);
+        case 0xDC: return ReadLength(2, Size) && ParseContainer(Depth, Size, false);
+        case 0xDD: return ReadLength(4, Size) && ParseContainer(Depth, Size, false);
+        case 0xDE: return ReadLength(2, Size) && ParseContainer(Depth, Size, true);
+        case 0xDF: return ReadLength(4, Size) && ParseContainer(Depth, Size, true);
+        default:
+            --Pos;
+            return Fail(TEXT("Invalid MessagePack tag"));
+        }
+    }
+};
+
+bool FUnrealMCPJsonDocument::ParseMessagePack(const uint8* Data, int32 Length, FString& OutErrorMessage)
+{
+    Nodes.Reset();
+    Strings.Reset();
+    Floats.Reset();
+    // Seeded like the JSON parser; packed float arrays take no tape nodes per element
+    Nodes.Reserve(Length / 16 + 1);
+
+    FUnrealMCPMessagePackParser Parser(*this, Data, Length);
+    bool bParsed = Parser.ParseValue(0);
+    if (bParsed && Parser.Pos != Length)
+    {
+        bParsed = Parser.Fail(TEXT("Unexpected data after value"));
+    }
+
+    if (!bParsed)
+    {
+        OutErrorMessage = Parser.Error;
+        Nodes.Reset();
+        Strings.Reset();
+        Floats.Reset();
+    }
+    return bParsed;
+}
+
+// Encoding helpers for FUnrealMCPMessagePackWriter
+struct FUnrealMCPMessagePackEncoding
+{
+    static void AppendBigEndian(TArray<uint8>& OutBytes, uint64 Value, int32 Bytes)
+    {
+        for (int32 Shift = (Bytes - 1) * 8; Shift >= 0; Shift -= 8)
+        {
+            OutBytes.Add((uint8)(Value >> Shift));
+        }
+    }
+
+    // Header of a str/array/map: the fix form when Count fits, otherwise a 16 or 32 bit length
+    static void AppendSizedHeader(TArray<uint8>& OutBytes, uint32 Count, uint8 FixTag, uint32 FixLimit, uint8 Tag8, uint8 Tag16, uint8 Tag32)
+    {
+        if (Count < FixLimit)
+        {
+            OutBytes.Add((uint8)(FixTag | Count));
+        }
+        else if (Tag8 != 0 && Count <= MAX_uint8)
+        {
+            OutBytes.Add(Tag8);
+            AppendBigEndian(OutBytes, Count, 1);
+        }
+        else if (Count <= MAX_uint16)
+        {
+            OutBytes.Add(Tag16);
+            AppendBigEndian(OutBytes, Count, 2);
+        }
+        else
+        {
+            OutBytes.Add(Tag32);
+            AppendBigEndian(OutBytes, Count, 4);
+        }
+    }
+
+    static void AppendString(TArray<uint8>& OutBytes, FStringView Value)
+    {
+        FTCHARToUTF8 Converted(Value.GetData(), Value.Len());
+        AppendSizedHeader(OutBytes, (uint32)Converted.Length(), 0xA0, 32, 0xD9, 0xDA, 0xDB);
+        OutBytes.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+    }
+
+    static void AppendNumber(TArray<uint8>& OutBytes, double Value)
+    {
+        if (!FMath::IsFinite(Value))
+        {
+            // Same as the JSON writer: non-finite numbers have no portable encoding
+            OutBytes.Add(0xC0);
+            return;
+        }
+
+        // Integral values take the smallest integer form, everything else a float64
+        if (Value == FMath::TruncToDouble(Value) && FMath::Abs(Value) < 9.2e18)
+        {
+            AppendInt(OutBytes, (int64)Value);
+            return;
+        }
+
+        uint64 Bits;
+        FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+        OutBytes.Add(0xCB);
+        AppendBigEndian(OutBytes, Bits, 8);
+    }
+
+    static void AppendInt(TArray<uint8>& OutBytes, int64 Integer)
+    {
+        if (Integer >= 0)
+        {
+            if (Integer <= 0x7F) { OutBytes.Add((uint8)Integer); }
+            else if (Integer <= MAX_uint8) { OutBytes.Add(0xCC); AppendBigEndian(OutBytes, Integer, 1); }
+            else if (Integer <= MAX_uint16) { OutBytes.Add(0xCD); AppendBigEndian(OutBytes, Integer, 2); }
+            else if (Integer <= MAX_uint32) { OutBytes.Add(0xCE); AppendBigEndian(OutBytes, Integer, 4); }
+            else { OutBytes.Add(0xCF); AppendBigEndian(OutBytes, Integer, 8); }
+        }
+        else
+        {
+            if (Integer >= -32) { OutBytes.Add((uint8)(int8)Integer); }
+            else if (Integer >= MIN_int8) { OutBytes.Add(0xD0); AppendBigEndian(OutBytes, (uint64)Integer, 1); }
+            else if (Integer >= MIN_int16) { OutBytes.Add(0xD1); AppendBigEndian(OutBytes, (uint64)Integer, 2); }
+            else if (Integer >= MIN_int32) { OutBytes.Add(0xD2); AppendBigEndian(OutBytes, (uint64)Integer, 4); }
+            else { OutBytes.Add(0xD3); AppendBigEndian(OutBytes, (uint64)Integer, 8); }
+        }
+    }
+
+    // Float array extension: ext header sized to the payload, then little-endian float32 values
+    static void AppendFloatArray(TArray<uint8>& OutBytes, TConstArrayView<float> Values)
+    {
+        const uint32 ByteCount = (uint32)(Values.Num() * sizeof(float));
+        switch (ByteCount)
+        {
+        case 4:  OutBytes.Add(0xD6); break;
+        case 8:  OutBytes.Add(0xD7); break;
+        case 16: OutBytes.Add(0xD8); break;
+        default: AppendSizedHeader(OutBytes, ByteCount, 0, 0, 0xC7, 0xC8, 0xC9); break;
+        }
+        OutBytes.Add((uint8)FUnrealMCPJsonDocument::MessagePackFloatArrayType);
+        OutBytes.Append(reinterpret_cast<const uint8*>(Values.GetData()), ByteCount);
+    }
+};
+
+FUnrealMCPMessagePackWriter::FUnrealMCPMessagePackWriter(TArray<uint8>& InBuffer)
+    : FUnrealMCPJsonWriter(InBuffer)
+{
+}
+
+void FUnrealMCPMessagePackWriter::BeginValue()
+{
+    if (Open.Num() > 0 && !Open.Last().bMap)
+    {
+        ++Open.Last().Count;
+    }
+}
+
+void FUnrealMCPMessagePackWriter::BeginContainer(uint8 Tag, bool bMap)
+{
+    BeginValue();
+
+    FOpenContainer& Container = Open.AddDefaulted_GetRef();
+    Container.HeaderOffset = Buffer.Num();
+    Container.bMap = bMap;
+    Buffer.Add(Tag);
+    Buffer.AddZeroed(4);
+}
+
+void FUnrealMCPMessagePackWriter::EndContainer()
+{
+    const FOpenContainer Container = Open.Pop(EAllowShrinking::No);
+    for (int32 Byte = 0; Byte < 4; ++Byte)
+    {
+        Buffer[Container.HeaderOffset + 1 + Byte] = (uint8)(Container.Count >> ((3 - Byte) * 8));
+    }
+}
+
+void FUnrealMCPMessagePackWriter::BeginObject()
+{
+    BeginContainer(0xDF, true);
+}
+
+void FUnrealMCPMessagePackWriter::EndObject()
+{
+    EndContainer();
+}
+
+void FUnrealMCPMessagePackWriter::BeginArray()
+{
+    BeginContainer(0xDD, false);
+}
+
+void FUnrealMCPMessagePackWriter::EndArray()
+{
+    EndContainer();
+}
+
+void FUnrealMCPMessagePackWriter::WriteKey(const TCHAR* Key)
+{
+    ++Open.Last().Count;
+    FUnrealMCPMessagePackEncoding::AppendString(Buffer, FStringView(Key));
+}
+
+void FUnrealMCPMessagePackWriter::WriteKey(const FString& Key)
+{
+    ++Open.Last().Count;
+    FUnrealMCPMessagePackEncoding::AppendString(Buffer, Key);
+}
+
+void FUnrealMCPMessagePackWriter::WriteString(const TCHAR* Value)
+{
+    BeginValue();
+    FUnrealMCPMessagePackEncoding::AppendString(Buffer, FStringView(Value));
+}
+
+void FUnrealMCPMessagePackWriter::WriteString(const FString& Value)
+{
+    BeginValue();
+    FUnrealMCPMessagePackEncoding::AppendString(Buffer, Value);
+}
+
+void FUnrealMCPMessagePackWriter::WriteNumber(double Value)
+{
+    BeginValue();
+    FUnrealMCPMessagePackEncoding::AppendNumber(Buffer, Value);
+}
+
+void FUnrealMCPMessagePackWriter::WriteInt(int64 Value)
+{
+    BeginValue();
+    FUnrealMCPMessagePackEncoding::AppendInt(Buffer, Value);
+}
+
+void FUnrealMCPMessagePackWriter::WriteBool(bool Value)
+{
+    BeginValue();
+    Buffer.Add(Value ? 0xC3 : 0xC2);
+}
+
+void FUnrealMCPMessagePackWriter::WriteNull()
+{
+    BeginValue();
+    Buffer.Add(0xC0);
+}
+
+void FUnrealMCPMessagePackWriter::WriteFloatArray(TConstArrayView<float> Values, bool bBase64)
+{
+    // The extension already carries raw bytes, so there is nothing for base64 to save
+    BeginValue();
+    FUnrealMCPMessagePackEncoding::AppendFloatArray(Buffer, Values);
+}
+
+void FUnrealMCPMessagePackWriter::WriteBinary(TConstArrayView<uint8> Bytes)
+{
+    BeginValue();
+    FUnrealMCPMessagePackEncoding::AppendSizedHeader(Buffer, (uint32)Bytes.Num(), 0, 0, 0xC4, 0xC5, 0xC6);
+    Buffer.Append(Bytes.GetData(), Bytes.Num());
+}
@@ -1,5 +1,9 @@
 #include "UnrealMCPModule.h"
 #include "UnrealMCPBridge.h"
+#include "Commands/UnrealMCPCompileQueue.h"
+#include "Commands/UnrealMCPFunctionIndex.h"
+#include "Commands/UnrealMCPInvalidation.h"
+#include "Commands/UnrealMCPNodeSearch.h"
 #include "Modules/ModuleManager.h"
 
 #define LOCTEXT_NAMESPACE "FUnrealMCPModule"
@@ -8,9 +12,15 @@ void FUnrealMCPModule::StartupModule()
 {
 	UE_LOG(LogTemp, Display, TEXT("Unreal MCP Module has started"));
 
+	// Keep the caches in step with compiles, reloads and asset changes
+	FUnrealMCPInvalidation::Startup();
+
 	MCPBridge = NewObject<UUnrealMCPBridge>();
 	MCPBridge->AddToRoot(); // Prevent garbage collection
 	MCPBridge->StartServer();
+
+	// Index callable functions in the background so the first function node does not pay for it
+	FUnrealMCPFunctionIndex::StartBuild();
 }
 
 void FUnrealMCPModule::ShutdownModule()
@@ -22,6 +32,11 @@ void FUnrealMCPModule::ShutdownModule()
 		MCPBridge->StopServer();
 		MCPBridge->RemoveFromRoot();
 	}
+
+	FUnrealMCPFunctionIndex::StopBuild();
+	FUnrealMCPCompileQueue::StopIdleTicker();
+	FUnrealMCPNodeSearch::Shutdown();
+	FUnrealMCPInvalidation::Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
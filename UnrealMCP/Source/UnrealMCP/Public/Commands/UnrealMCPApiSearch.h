@@ -0,0 +1,109 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * search_functions and search_classes: ranked, paged discovery of the names that
+ * add_blueprint_function_node, add_component_to_blueprint and spawn commands accept.
+ *
+ * The catalog is a snapshot of plain strings taken from FUnrealMCPFunctionIndex on the game
+ * thread: signatures, categories and modules are formatted once, and names are split into
+ * lower-case word tokens with a sorted inverted index over them, so a token prefix is one
+ * binary-searched range. Searching touches no UObjects, so
+ * the bridge answers these commands on the connection thread while a current snapshot exists.
+ * The snapshot is marked stale when the function index changes and retaken by the next search
+ * that reaches the game thread.
+ */
+class UNREALMCP_API FUnrealMCPApiSearch
+{
+public:
+    static bool IsSearchCommand(const FString& CommandType);
+
+    // True when a current snapshot exists, so a search can be answered from any thread
+    static bool IsReady();
+
+    // Any thread when IsReady; otherwise the game thread, which takes the snapshot first
+    static TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
+    // Called by the function index whenever its contents change
+    static void Invalidate();
+
+private:
+    struct FFunctionRecord
+    {
+        FString Name;
+        FString DisplayName;
+        FString ClassName;
+        FString ClassPath;
+        FString Module;
+        FString Category;
+        FString Signature;
+        bool bStatic = false;
+        bool bPure = false;
+    };
+
+    struct FClassRecord
+    {
+        FString Name;
+        FString Path;
+        FString ParentName;
+        // Index of the parent's record, resolved by path since short names can repeat across modules
+        int32 ParentIndex = INDEX_NONE;
+        FString Module;
+        FString Kind;
+        bool bAbstract = false;
+        bool bSpawnable = false;
+    };
+
+    // One searchable name: lower-cased full name, its word tokens, and lower-cased context
+    // (class, category, display name) that counts for less
+    struct FSearchKey
+    {
+        FString Lower;
+        TArray<FString> Tokens;
+        FString Secondary;
+    };
+
+    // Distinct tokens in sorted order, each with the records containing it
+    struct FTokenIndex
+    {
+        TArray<FString> Tokens;
+        TArray<TArray<int32>> Records;
+    };
+
+    struct FCatalog
+    {
+        TArray<FFunctionRecord> Functions;
+        TArray<FSearchKey> FunctionKeys;
+        FTokenIndex FunctionTokens;
+
+        TArray<FClassRecord> Classes;
+        TArray<FSearchKey> ClassKeys;
+        FTokenIndex ClassTokens;
+        // Lower-cased name to every class of that name, and lower-cased path to its class
+        TMap<FString, TArray<int32>> ClassIndicesByName;
+        TMap<FString, int32> ClassIndexByPath;
+    };
+
+    static TSharedPtr<const FCatalog> GetCatalog();
+    static TSharedPtr<const FCatalog> BuildCatalog();
+
+    static TSharedPtr<FJsonObject> SearchFunctions(const FCatalog& Catalog, const TSharedPtr<FJsonObject>& Params);
+    static TSharedPtr<FJsonObject> SearchClasses(const FCatalog& Catalog, const TSharedPtr<FJsonObject>& Params);
+
+    static FSearchKey MakeSearchKey(const FString& Name, const FString& Secondary = FString());
+    static void Tokenize(const FString& Text, TArray<FString>& OutTokens);
+    static int32 Score(const FSearchKey& Key, const FSearchKey& Query);
+    static int32 FuzzyScore(const FString& Candidate, const FString& Pattern);
+    static void BuildTokenIndex(const TArray<FSearchKey>& Keys, FTokenIndex& OutIndex);
+    static void GatherCandidates(const FTokenIndex& TokenIndex, const FSearchKey& Query, int32 RecordCount, TArray<int32>& OutCandidates);
+
+    // Class record for a name, with or without its A/U prefix, or a path; INDEX_NONE with the reason when unknown or ambiguous
+    static int32 FindClassRecord(const FCatalog& Catalog, const FString& ClassName, FString& OutErrorMessage);
+
+    static FCriticalSection CatalogLock;
+    static TSharedPtr<const FCatalog> CurrentCatalog;
+    static bool bStale;
+};
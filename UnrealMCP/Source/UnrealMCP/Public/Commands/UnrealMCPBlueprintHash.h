@@ -0,0 +1,32 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Hash/xxhash.h"
+
+class UBlueprint;
+class UEdGraph;
+class UEdGraphNode;
+class UObject;
+
+/**
+ * Structural hashes of blueprint content: everything that feeds the compiler, and nothing
+ * that only affects presentation such as node positions, comments or compiler messages.
+ * Two equal hashes mean a recompile would produce the same class.
+ */
+class UNREALMCP_API FUnrealMCPBlueprintHash
+{
+public:
+    // Class settings, variables, graphs and every other subobject of the blueprint (SCS nodes, widget trees, timelines)
+    static uint64 Compute(const UBlueprint* Blueprint);
+
+    // One graph and its nodes, including pin links and defaults
+    static uint64 ComputeGraph(const UEdGraph* Graph);
+
+    // One node: its properties, pins, pin defaults and links
+    static uint64 ComputeNode(const UEdGraphNode* Node);
+
+private:
+    static uint64 HashObject(const UObject* Object);
+    static void HashProperties(const UObject* Object, FXxHash64Builder& Builder);
+    static void HashString(const FString& Value, FXxHash64Builder& Builder);
+};
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UBlueprint;
+
+/**
+ * Name to asset index over every blueprint the asset registry knows about, so commands can
+ * refer to a blueprint by its short name wherever it lives in the project.
+ * Built from the registry on first use and kept current from its added, removed and renamed events.
+ * Each entry remembers its loaded blueprint weakly, so repeated commands on one blueprint skip path resolution.
+ */
+class UNREALMCP_API FUnrealMCPBlueprintIndex
+{
+public:
+    /**
+     * Resolve a blueprint by asset name ("BP_Door"), package path ("/Game/Doors/BP_Door")
+     * or object path ("/Game/Doors/BP_Door.BP_Door"). BlueprintClass narrows the candidates,
+     * e.g. to widget blueprints. Returns null with a reason in OutErrorMessage when nothing
+     * matches or when the name matches more than one asset.
+     */
+    static UBlueprint* Find(const FString& Name, UClass* BlueprintClass, FString& OutErrorMessage);
+
+    // Object paths of every indexed blueprint with this asset name
+    static void GetPathsForName(const FString& AssetName, TArray<FSoftObjectPath>& OutPaths);
+
+    // Drop the index; the next lookup rebuilds it from the registry
+    static void Reset();
+
+private:
+    // Forwards asset registry changes
+    friend class FUnrealMCPInvalidation;
+
+    struct FEntry
+    {
+        FAssetData AssetData;
+        TWeakObjectPtr<UBlueprint> Blueprint;
+    };
+
+    static void EnsureBuilt();
+    static bool IsBlueprintAsset(const FAssetData& AssetData);
+    static bool MatchesClass(const FEntry& Entry, UClass* BlueprintClass);
+    static UBlueprint* Load(const FAssetData& AssetData);
+
+    static void AddAsset(const FAssetData& AssetData);
+    static void RemoveAsset(FName AssetName, const FSoftObjectPath& ObjectPath);
+    static void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+    static bool bBuilt;
+    static TSet<FTopLevelAssetPath> BlueprintClassPaths;
+    static TMap<FName, TArray<FEntry>> EntriesByName;
+};
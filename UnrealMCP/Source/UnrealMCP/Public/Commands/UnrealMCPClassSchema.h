@@ -0,0 +1,43 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "UObject/ObjectKey.h"
+
+class UClass;
+class FProperty;
+
+/**
+ * Serialization plan for one class: the editable properties worth reporting,
+ * with their display names and categories looked up once.
+ * Plans are cached per class, so repeated dumps of the same class skip the reflection walk.
+ */
+class UNREALMCP_API FUnrealMCPClassSchema
+{
+public:
+    struct FEntry
+    {
+        FProperty* Property = nullptr;
+        FString Name;
+        FString Category;
+    };
+
+    // Get the cached plan for Class, building it on first use
+    static TSharedPtr<const FUnrealMCPClassSchema> Get(UClass* Class);
+
+    // Drop all cached plans
+    static void ClearCache();
+
+    const TArray<FEntry>& GetEntries() const { return Entries; }
+
+    // Write the values of matching properties on Object into OutObject.
+    // CategoryFilter matches a category or any of its subcategories, NamePattern is a wildcard such as "*Light*".
+    int32 SerializeObject(const UObject* Object, const FString& CategoryFilter, const FString& NamePattern, const TSharedPtr<FJsonObject>& OutObject) const;
+
+private:
+    void Build(UClass* Class);
+
+    TArray<FEntry> Entries;
+
+    static TMap<FObjectKey, TSharedPtr<const FUnrealMCPClassSchema>> Cache;
+};
@@ -5,7 +5,9 @@
 
 // Forward declarations
 class AActor;
+class UWorld;
 class UBlueprint;
+class UClass;
 class UEdGraph;
 class UEdGraphNode;
 class UEdGraphPin;
@@ -16,6 +18,9 @@ class UK2Node_VariableSet;
 class UK2Node_InputAction;
 class UK2Node_Self;
 class UFunction;
+class FProperty;
+class FUnrealMCPJsonWriter;
+class FUnrealMCPJsonView;
 
 /**
  * Common utilities for UnrealMCP commands
@@ -28,16 +33,35 @@ public:
     static TSharedPtr<FJsonObject> CreateSuccessResponse(const TSharedPtr<FJsonObject>& Data = nullptr);
     static void GetIntArrayFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName, TArray<int32>& OutArray);
     static void GetFloatArrayFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName, TArray<float>& OutArray);
+    static void GetFloatArrayFromJson(const FUnrealMCPJsonView& JsonObject, const FString& FieldName, TArray<float>& OutArray);
     static FVector2D GetVector2DFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName);
     static FVector GetVectorFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName);
     static FRotator GetRotatorFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName);
+    static FVector GetVectorFromJson(const FUnrealMCPJsonView& JsonObject, const FString& FieldName);
+    static FRotator GetRotatorFromJson(const FUnrealMCPJsonView& JsonObject, const FString& FieldName);
+
+    /**
+     * Read a packed array of 3-component vectors from a JSON field.
+     * Accepts a flat number array [x0, y0, z0, x1, ...], an array of triples [[x, y, z], ...],
+     * or a base64 string holding little-endian float32 triples.
+     * A missing field yields an empty array and succeeds.
+     */
+    static bool GetPackedVectorArrayFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName, TArray<FVector>& OutVectors, FString& OutErrorMessage);
+    static bool GetPackedVectorArrayFromJson(const FUnrealMCPJsonView& JsonObject, const FString& FieldName, TArray<FVector>& OutVectors, FString& OutErrorMessage);
+    static bool DecodePackedVectorBase64(const FString& Encoded, const FString& FieldName, TArray<FVector>& OutVectors, FString& OutErrorMessage);
+    /** Inverse of GetPackedVectorArrayFromJson for packed XYZ floats: a flat number array, or a base64 float32 string when bBinary is set. */
+    static TSharedPtr<FJsonValue> PackedFloatArrayToJson(TConstArrayView<float> Values, bool bBinary);
     
     // Actor utilities
     static TSharedPtr<FJsonValue> ActorToJson(AActor* Actor);
     static TSharedPtr<FJsonObject> ActorToJsonObject(AActor* Actor, bool bDetailed = false);
+    static void WriteActorJson(FUnrealMCPJsonWriter& Writer, AActor* Actor);
+    static void BuildActorNameMap(UWorld* World, TMap<FName, AActor*>& OutActorsByName);
     
     // Blueprint utilities
     static UBlueprint* FindBlueprint(const FString& BlueprintName);
+    // Resolve by asset name or path anywhere in the project; OutErrorMessage says whether it was missing or ambiguous
+    static UBlueprint* FindBlueprint(const FString& BlueprintName, FString& OutErrorMessage, UClass* BlueprintClass = nullptr);
     static UBlueprint* FindBlueprintByName(const FString& BlueprintName);
     static UEdGraph* FindOrCreateEventGraph(UBlueprint* Blueprint);
     
@@ -57,4 +81,7 @@ public:
     // Property utilities
     static bool SetObjectProperty(UObject* Object, const FString& PropertyName, 
                                  const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage);
+    // Write a JSON value into an already resolved property value address
+    static bool SetPropertyValue(FProperty* Property, void* PropertyAddr,
+                                const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage);
 }; 
\ No newline at end of file
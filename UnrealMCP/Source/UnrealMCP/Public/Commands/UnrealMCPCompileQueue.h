@@ -0,0 +1,75 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "UObject/WeakObjectPtr.h"
+#include "UObject/ObjectKey.h"
+
+class UBlueprint;
+
+/**
+ * Coalesces blueprint compiles across commands. Edits mark a blueprint dirty here instead of
+ * compiling it, and the pending set is compiled together, dependents included, in one pass:
+ * at the end of an execute_batch, on compile_blueprint, or once no edit has arrived for
+ * UnrealMCP.Blueprint.CompileIdleSeconds. UnrealMCP.Blueprint.CompilePolicy selects the policy.
+ *
+ * Each successful compile records the blueprint's structural hash and the hashes of the
+ * blueprints it depends on. A compile request that finds both unchanged is skipped and the
+ * blueprint keeps its last result, unless the caller forces it.
+ */
+class UNREALMCP_API FUnrealMCPCompileQueue
+{
+public:
+    enum class EPolicy : int32
+    {
+        // Compile on every edit, as each command did before the queue existed
+        Immediate = 0,
+        // Compile at the end of a batch, on compile_blueprint, or when the editor goes idle
+        Deferred = 1,
+    };
+
+    static EPolicy GetPolicy();
+
+    // Record that Blueprint has edits waiting for a compile
+    static void MarkDirty(UBlueprint* Blueprint);
+
+    // Compile Blueprint now if it has pending edits, for commands that read its GeneratedClass or CDO
+    static void EnsureCompiled(UBlueprint* Blueprint);
+
+    // Compile every pending blueprint, plus AlsoCompile when given, and the blueprints that depend on them.
+    // Unchanged blueprints are skipped and added to OutSkipped unless bForce is set. Returns how many were compiled.
+    static int32 Flush(UBlueprint* AlsoCompile = nullptr, bool bForce = false, TArray<UBlueprint*>* OutSkipped = nullptr);
+
+    // Compile Blueprints now as one batch, taking them off the pending set. Returns how many were compiled.
+    static int32 CompileNow(const TArray<UBlueprint*>& Blueprints, bool bIncludeDependents = true, bool bForce = false, TArray<UBlueprint*>* OutSkipped = nullptr);
+
+    // Errors and warnings the last compile left on Blueprint's nodes
+    static void GetCompilerMessages(UBlueprint* Blueprint, TArray<FString>& OutErrors, TArray<FString>& OutWarnings);
+
+    static bool IsPending(const UBlueprint* Blueprint);
+    static int32 NumPending();
+
+    // Stop waiting for the editor to go idle, at module shutdown; pending edits stay uncompiled
+    static void StopIdleTicker();
+
+private:
+    // Drops records on reload
+    friend class FUnrealMCPInvalidation;
+
+    struct FCompileRecord
+    {
+        uint64 StructureHash = 0;
+        uint64 DependencyHash = 0;
+    };
+
+    static int32 Compile(const TArray<UBlueprint*>& Blueprints, bool bIncludeDependents = true, bool bForce = false, TArray<UBlueprint*>* OutSkipped = nullptr);
+    static bool IsUnchangedSinceLastCompile(UBlueprint* Blueprint, TMap<const UBlueprint*, uint64>& HashCache);
+    static uint64 GetStructureHash(const UBlueprint* Blueprint, TMap<const UBlueprint*, uint64>& HashCache);
+    static uint64 GetDependencyHash(UBlueprint* Blueprint, TMap<const UBlueprint*, uint64>& HashCache);
+    static bool TickIdle(float DeltaTime);
+
+    static TArray<TWeakObjectPtr<UBlueprint>> Pending;
+    static TMap<FObjectKey, FCompileRecord> Records;
+    static double LastDirtyTime;
+    static FTSTicker::FDelegateHandle IdleTickerHandle;
+};
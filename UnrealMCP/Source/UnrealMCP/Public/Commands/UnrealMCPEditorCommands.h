@@ -2,6 +2,9 @@
 #include "CoreMinimal.h"
 #include "Json.h"
 
+class FUnrealMCPJsonWriter;
+class FUnrealMCPJsonView;
+
 /**
  * Handler class for Editor-related MCP commands
  * Handles viewport control, actor manipulation, and level management
@@ -14,6 +17,17 @@ public:
     // Handle editor commands
     TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
 
+    // Commands whose result can be written straight into the response buffer
+    static bool IsStreamingCommand(const FString& CommandType);
+
+    // Write the result of a streaming command as one JSON value.
+    // On failure nothing is written and OutErrorMessage is set.
+    bool StreamCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, FUnrealMCPJsonWriter& Writer, FString& OutErrorMessage);
+
+    // Bulk commands that read their parameters directly from the request document
+    static bool IsViewCommand(const FString& CommandType);
+    TSharedPtr<FJsonObject> HandleViewCommand(const FString& CommandType, const FUnrealMCPJsonView& Params);
+
 private:
     // Actor manipulation commands
     TSharedPtr<FJsonObject> HandleGetActorsInLevel(const TSharedPtr<FJsonObject>& Params);
@@ -21,8 +35,14 @@ private:
     TSharedPtr<FJsonObject> HandleSpawnActor(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleDeleteActor(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleSetActorTransform(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleSetActorTransforms(const FUnrealMCPJsonView& Params);
     TSharedPtr<FJsonObject> HandleGetActorProperties(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleSetActorProperty(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleSetPropertyBulk(const TSharedPtr<FJsonObject>& Params);
+
+    // Streaming variants of the actor listing commands
+    bool StreamGetActorsInLevel(const TSharedPtr<FJsonObject>& Params, FUnrealMCPJsonWriter& Writer, FString& OutErrorMessage);
+    bool StreamFindActorsByName(const TSharedPtr<FJsonObject>& Params, FUnrealMCPJsonWriter& Writer, FString& OutErrorMessage);
 
     // Material on Actor
     TSharedPtr<FJsonObject> HandleSetActorMaterial(const TSharedPtr<FJsonObject>& Params);
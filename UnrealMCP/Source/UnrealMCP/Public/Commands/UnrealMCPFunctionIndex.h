@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UClass;
+class UFunction;
+
+/**
+ * Index of native classes by name and of their BlueprintCallable functions by function name
+ * and declaring class. It resolves add_blueprint_function_node targets, spawn_actor types,
+ * component types and class pin defaults without searching every package.
+ *
+ * StartBuild, called at module startup, walks the native classes a few milliseconds per tick
+ * so the editor is not held up; a lookup that arrives first finishes the walk on the spot.
+ * Loading a module adds its classes and a hot reload rebuilds it; StopBuild, called at module
+ * shutdown, cancels a walk still in progress.
+ */
+class UNREALMCP_API FUnrealMCPFunctionIndex
+{
+public:
+    static void StartBuild();
+    static void StopBuild();
+
+    /**
+     * Resolve a native class by name, with or without its A/U/I prefix, with or without a
+     * trailing "Component", or by its /Script path. Blueprint classes resolve through the
+     * blueprint index. With RequiredBase, only classes derived from it are considered.
+     * Returns null with the reason when the name is unknown, ambiguous or of the wrong kind.
+     */
+    static UClass* FindClass(const FString& ClassName, FString& OutErrorMessage, UClass* RequiredBase = nullptr);
+
+    // Whether spawn_actor (actor classes) or add_component_to_blueprint (component classes) accepts Class
+    static bool IsSpawnable(const UClass* Class);
+
+    /**
+     * Resolve a callable function. With ClassName, the function is looked up on that class and
+     * its parents. Without it, FallbackClass (typically the blueprint's own class) and its parents
+     * are tried first, then the static functions of that name; member functions of other classes
+     * and more than one static match are errors listing the declaring classes, so the caller can
+     * pass a target.
+     */
+    static UFunction* FindFunction(const FString& FunctionName, const FString& ClassName, UClass* FallbackClass, FString& OutErrorMessage);
+
+private:
+    // The search catalog is a snapshot of this index
+    friend class FUnrealMCPApiSearch;
+    // Forwards module loads and hot reloads
+    friend class FUnrealMCPInvalidation;
+
+    struct FFunctionEntry
+    {
+        TWeakObjectPtr<UFunction> Function;
+        TWeakObjectPtr<UClass> Class;
+    };
+
+    static void EnsureBuilt();
+    static void IndexClass(UClass* Class);
+    static bool TickBuild(float DeltaTime);
+    static void Rebuild();
+    static void AddModuleClasses(FName ModuleName);
+
+    // Native classes not yet walked by the time-sliced build
+    static TArray<TWeakObjectPtr<UClass>> PendingClasses;
+    static TMap<FName, TArray<TWeakObjectPtr<UClass>>> ClassesByName;
+    static TMap<FName, TArray<FFunctionEntry>> FunctionsByName;
+    static FTSTicker::FDelegateHandle BuildTickerHandle;
+    static bool bStarted;
+};
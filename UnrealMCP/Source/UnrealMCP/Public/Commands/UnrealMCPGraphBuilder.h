@@ -0,0 +1,28 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+class UBlueprint;
+class UEdGraph;
+class UEdGraphNode;
+class UEdGraphPin;
+
+/**
+ * Builds a piece of blueprint logic from a declarative spec for build_blueprint_graph.
+ *
+ * The spec lists nodes under caller-chosen local ids, pin defaults per node, and links that
+ * name their ends by local id or by the guid of a node already in the graph. Everything is
+ * created inside the caller's transaction; the blueprint is marked modified once by the caller.
+ * A node or link that fails is reported and skipped without stopping the rest.
+ */
+class UNREALMCP_API FUnrealMCPGraphBuilder
+{
+public:
+    // Create Spec's nodes and links in Graph. The result maps local ids to node guids and lists per node and per link errors.
+    static TSharedPtr<FJsonObject> Build(UBlueprint* Blueprint, UEdGraph* Graph, const TSharedPtr<FJsonObject>& Spec, int32& OutCreatedCount, int32& OutLinkedCount);
+
+private:
+    static UEdGraphNode* CreateNode(UBlueprint* Blueprint, UEdGraph* Graph, const TSharedPtr<FJsonObject>& NodeSpec, FString& OutErrorMessage);
+    static bool SetPinDefault(UEdGraphPin* Pin, const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage);
+};
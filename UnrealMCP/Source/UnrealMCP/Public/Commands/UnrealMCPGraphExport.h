@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "UObject/ObjectKey.h"
+
+class UBlueprint;
+class UEdGraph;
+class UEdGraphNode;
+struct FEdGraphPinType;
+
+/**
+ * Compact export of a blueprint's graphs for get_blueprint_graph.
+ *
+ * Graphs and nodes get small integer ids that stay stable for the editor session, strings
+ * (classes, titles, pin names, types and defaults) are written once into a string table and
+ * referenced by index, and each export carries a revision token. Passing that token back
+ * returns only the nodes and links that changed since, plus the ids of removed nodes.
+ *
+ * Node hashes (a reflection export of each node) are kept per graph until the graph, one of
+ * its nodes or its blueprint is modified, so exporting or diffing an untouched graph only
+ * walks its nodes and links. Any edit to a blueprint rehashes all of its graphs.
+ */
+class UNREALMCP_API FUnrealMCPGraphExport
+{
+public:
+    // Export Blueprint's graphs, or only the graph named GraphName. An empty or unknown SinceRevision gives a full export.
+    static TSharedPtr<FJsonObject> Export(UBlueprint* Blueprint, const FString& GraphName, const FString& SinceRevision);
+
+private:
+    friend class FUnrealMCPInvalidation;
+
+    // Drop cached node hashes for the graph Object belongs to, or all graphs of a blueprint
+    static void OnObjectChanged(UObject* Object);
+    static void ClearCache();
+
+    // What one export looked like, for diffing the next one against
+    struct FSnapshot
+    {
+        uint64 Revision = 0;
+        TMap<int32, uint64> NodeHashes;
+        TSet<FIntVector4> Links;
+    };
+
+    // Per blueprint and graph filter: stable ids plus the last few snapshots
+    struct FBlueprintState
+    {
+        TMap<FGuid, int32> Ids;
+        int32 NextId = 1;
+        TArray<FSnapshot> Snapshots;
+    };
+
+    static int32 GetId(FBlueprintState& State, const FGuid& Guid);
+    static FString DescribePinType(const FEdGraphPinType& PinType);
+    static const TCHAR* DescribeGraphType(const UBlueprint* Blueprint, const UEdGraph* Graph);
+
+    // Node hashes of one graph, valid until it or its blueprint is modified
+    struct FGraphHashes
+    {
+        FObjectKey Blueprint;
+        TMap<FObjectKey, uint64> NodeHashes;
+    };
+
+    static TMap<FString, FBlueprintState> States;
+    static TMap<FObjectKey, FGraphHashes> GraphHashes;
+    static uint64 NextRevision;
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+class AActor;
+class UWorld;
+class UStaticMesh;
+class UMaterialInterface;
+class UHierarchicalInstancedStaticMeshComponent;
+class FUnrealMCPJsonView;
+class FUnrealMCPJsonWriter;
+
+/**
+ * Handler class for instanced mesh MCP commands
+ * Places large sets of repeated meshes as instances of a single
+ * hierarchical instanced static mesh component instead of one actor per copy.
+ */
+class UNREALMCP_API FUnrealMCPInstanceCommands
+{
+public:
+    FUnrealMCPInstanceCommands();
+
+    // Handle instance commands
+    TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
+    // Commands whose result can be written straight into the response buffer, so packed
+    // float arrays reach MessagePack connections as the float array extension
+    static bool IsStreamingCommand(const FString& CommandType);
+
+    // Write the result of a streaming command as one value.
+    // On failure nothing is written and OutErrorMessage is set.
+    bool StreamCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, FUnrealMCPJsonWriter& Writer, FString& OutErrorMessage);
+
+    // Bulk commands that read their parameters directly from the request document
+    static bool IsViewCommand(const FString& CommandType);
+    TSharedPtr<FJsonObject> HandleViewCommand(const FString& CommandType, const FUnrealMCPJsonView& Params);
+
+private:
+    // Specific instance command handlers
+    TSharedPtr<FJsonObject> HandleAddMeshInstances(const FUnrealMCPJsonView& Params);
+    TSharedPtr<FJsonObject> HandleGetMeshInstances(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleUpdateMeshInstances(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleRemoveMeshInstances(const TSharedPtr<FJsonObject>& Params);
+    bool StreamGetMeshInstances(const TSharedPtr<FJsonObject>& Params, FUnrealMCPJsonWriter& Writer, FString& OutErrorMessage);
+
+    // Instances chosen by get_mesh_instances, with their transforms as packed XYZ floats
+    struct FMeshInstanceSelection
+    {
+        UHierarchicalInstancedStaticMeshComponent* Component = nullptr;
+        int32 InstanceCount = 0;
+        TArray<int32> Indices;
+        TArray<float> Locations;
+        TArray<float> Rotations;
+        TArray<float> Scales;
+        bool bBinary = false;
+    };
+    TSharedPtr<FJsonObject> HandleScatterInstances(const TSharedPtr<FJsonObject>& Params);
+
+    // Area to scatter over: an XY bounding box, optionally clipped to a closed polygon
+    struct FScatterRegion
+    {
+        FBox Bounds;
+        TArray<FVector2D> Polygon;
+
+        // Ground traces start this far above Bounds and end this far below it
+        double TraceHeight = 0.0;
+
+        bool Contains(const FVector2D& Point) const;
+    };
+
+    // Helper functions
+    UHierarchicalInstancedStaticMeshComponent* FindOrCreateInstancedComponent(UWorld* World, const FString& HostActorName,
+                                                                              const FString& ComponentName, UStaticMesh* Mesh,
+                                                                              UMaterialInterface* Material, FString& OutErrorMessage);
+    UHierarchicalInstancedStaticMeshComponent* FindInstancedComponent(const TSharedPtr<FJsonObject>& Params, FString& OutErrorMessage);
+    static AActor* FindHostActor(UWorld* World, const FString& HostActorName);
+    bool SelectMeshInstances(const TSharedPtr<FJsonObject>& Params, FMeshInstanceSelection& OutSelection, FString& OutErrorMessage);
+    bool GetScatterRegionFromJson(UWorld* World, const TSharedPtr<FJsonObject>& Params, FScatterRegion& OutRegion, FString& OutErrorMessage);
+    bool GetTransformsFromJson(const FUnrealMCPJsonView& Params, TArray<FTransform>& OutTransforms, FString& OutErrorMessage);
+};
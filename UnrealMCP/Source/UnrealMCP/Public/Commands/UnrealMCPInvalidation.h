@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/UObjectGlobals.h"
+
+struct FAssetData;
+class UPackage;
+class FObjectPostSaveContext;
+
+/**
+ * The one place the module's caches subscribe to engine events. Blueprint compiles, reinstancing,
+ * hot reloads, module loads, asset registry changes and package edits are fanned out to the
+ * property path and class schema caches, the compile queue, the function and blueprint indexes,
+ * the node search index and the graph export's node hashes.
+ *
+ * Startup and Shutdown are called by the module, so nothing stays bound to an unloaded module.
+ */
+class UNREALMCP_API FUnrealMCPInvalidation
+{
+public:
+    static void Startup();
+    static void Shutdown();
+
+private:
+    static void BindEditorDelegates();
+    static void OnBlueprintCompiled();
+    static void OnObjectsReinstanced(const TMap<UObject*, UObject*>& OldToNewInstanceMap);
+    static void OnReloadComplete(EReloadCompleteReason Reason);
+    static void OnModulesChanged(FName ModuleName, EModuleChangeReason Reason);
+    static void OnAssetAdded(const FAssetData& AssetData);
+    static void OnAssetRemoved(const FAssetData& AssetData);
+    static void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+    static void OnPackageMarkedDirty(UPackage* Package, bool bWasDirty);
+    static void OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext);
+    static void OnObjectModified(UObject* Object);
+    static void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+
+    // Caches holding FProperty or UClass pointers, which a recompile or reload replaces
+    static void ClearClassCaches();
+
+    static FDelegateHandle PostEngineInitHandle;
+    static FDelegateHandle BlueprintCompiledHandle;
+    static FDelegateHandle ObjectsReinstancedHandle;
+    static FDelegateHandle ReloadCompleteHandle;
+    static FDelegateHandle ModulesChangedHandle;
+    static FDelegateHandle AssetAddedHandle;
+    static FDelegateHandle AssetRemovedHandle;
+    static FDelegateHandle AssetRenamedHandle;
+    static FDelegateHandle PackageMarkedDirtyHandle;
+    static FDelegateHandle PackageSavedHandle;
+    static FDelegateHandle ObjectModifiedHandle;
+    static FDelegateHandle ObjectPropertyChangedHandle;
+};
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "AssetRegistry/AssetData.h"
+#include "Containers/Ticker.h"
+
+class UBlueprint;
+
+/**
+ * Node index behind search_blueprint_nodes. Every graph of a blueprint (ubergraph pages,
+ * functions, macros and their subgraphs) is reduced to one record per node: class, title,
+ * called function, referenced variable, event name and comment.
+ *
+ * Records are kept per package and persisted under Saved/UnrealMCP, tagged with the package's
+ * saved hash; the file is written a few seconds after the records change and at module shutdown,
+ * not by every search. A blueprint whose file has not changed is answered from its stored
+ * records; a loaded one is also re-read after its package has been dirtied or saved. An unloaded
+ * blueprint without current records is loaded only when the caller asks for it, and is otherwise
+ * reported as unindexed. Each entry keys its records by function, variable, event and node class,
+ * so a query naming one of those only tests the records that carry it.
+ */
+class UNREALMCP_API FUnrealMCPNodeSearch
+{
+public:
+    // Empty fields match everything; names compare case-insensitively, Comment is a substring
+    struct FQuery
+    {
+        FString NodeClass;
+        FString FunctionName;
+        FString VariableName;
+        FString EventName;
+        FString Comment;
+        FString GraphName;
+    };
+
+    // Search the given blueprint assets, stopping after MaxResults matches.
+    // bLoadAssets loads unloaded blueprints that have no current records so they can be indexed.
+    static TSharedPtr<FJsonObject> Search(const TArray<FAssetData>& Assets, const FQuery& Query, int32 MaxResults, bool bLoadAssets);
+
+    // Forget every record, on disk too
+    static void Reset();
+
+    // Write any unsaved records and stop the save ticker, at module shutdown
+    static void Shutdown();
+
+private:
+    // Forwards package edits, saves and asset removals
+    friend class FUnrealMCPInvalidation;
+
+    struct FNodeRecord
+    {
+        FString Graph;
+        FString NodeGuid;
+        FString NodeClass;
+        FString Title;
+        FString Function;
+        FString Variable;
+        FString Event;
+        FString Comment;
+    };
+
+    struct FEntry
+    {
+        // Saved hash of the package the records were read from; empty when read from unsaved edits
+        FString SavedHash;
+        bool bStale = false;
+        TArray<FNodeRecord> Nodes;
+
+        // Indices into Nodes by the names they reference; FName keys compare case-insensitively
+        TMap<FName, TArray<int32>> NodesByFunction;
+        TMap<FName, TArray<int32>> NodesByVariable;
+        TMap<FName, TArray<int32>> NodesByEvent;
+        TMap<FName, TArray<int32>> NodesByClass;
+    };
+
+    // Null when the blueprint has no current records and may not be loaded
+    static const FEntry* GetEntry(const FAssetData& AssetData, bool bLoadAssets, int32& InOutIndexedCount, int32& InOutLoadedCount);
+    static void IndexBlueprint(UBlueprint* Blueprint, FEntry& OutEntry);
+    static void BuildLookup(FEntry& InOutEntry);
+    static void GetCandidates(const FEntry& Entry, const FQuery& Query, TArray<int32>& OutIndices);
+    static bool Matches(const FNodeRecord& Record, const FQuery& Query);
+    static FString GetSavedHash(FName PackageName);
+    static void MarkStale(FName PackageName);
+    static void RemovePackage(FName PackageName);
+
+    static void EnsureLoaded();
+    // Flag the index file as behind and schedule a write
+    static void MarkIndexDirty();
+    static bool TickSave(float DeltaTime);
+    static void SaveIfDirty();
+    static FString GetIndexPath();
+
+    static bool bLoaded;
+    static bool bDirty;
+    static TMap<FName, FEntry> Entries;
+    static FTSTicker::FDelegateHandle SaveTickerHandle;
+};
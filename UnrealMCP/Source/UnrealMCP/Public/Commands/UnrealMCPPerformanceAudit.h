@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+class UBlueprint;
+class UEdGraph;
+class UEdGraphNode;
+class USCS_Node;
+
+/**
+ * Static checks behind audit_blueprint_performance, for per-frame and spawn-time costs that are
+ * visible in blueprint content:
+ * - tick_graph: a ticking blueprint whose Tick event runs more than a handful of nodes
+ * - tick_cast, tick_get_all_actors: casts and actor iteration reached from Tick
+ * - widget_binding: UMG property bindings, which are evaluated every frame while the widget is visible
+ * - construction_script: large construction scripts and loops in them, rerun on every move in the editor
+ * - component_hierarchy: component trees that are large or deep
+ * - not_compiled: edits since the last compile; the audit never compiles, so class defaults are the last compiled ones
+ *
+ * Each finding names the graph and node guids involved, the same ids the blueprint node
+ * commands take, so a fix can be applied without another lookup.
+ */
+class UNREALMCP_API FUnrealMCPPerformanceAudit
+{
+public:
+    struct FThresholds
+    {
+        // Nodes reached from Tick, the event itself excluded, before a Tick graph counts as non-trivial
+        int32 TickNodes = 4;
+        int32 ConstructionScriptNodes = 40;
+        int32 ComponentCount = 30;
+        int32 ComponentDepth = 5;
+    };
+
+    // Append Blueprint's findings to OutFindings
+    static void Audit(UBlueprint* Blueprint, const FThresholds& Thresholds, TArray<TSharedPtr<FJsonValue>>& OutFindings);
+
+private:
+    static void AuditTick(UBlueprint* Blueprint, const FThresholds& Thresholds, TArray<TSharedPtr<FJsonValue>>& OutFindings);
+    static void AuditWidgetBindings(UBlueprint* Blueprint, TArray<TSharedPtr<FJsonValue>>& OutFindings);
+    static void AuditConstructionScript(UBlueprint* Blueprint, const FThresholds& Thresholds, TArray<TSharedPtr<FJsonValue>>& OutFindings);
+    static void AuditComponents(UBlueprint* Blueprint, const FThresholds& Thresholds, TArray<TSharedPtr<FJsonValue>>& OutFindings);
+
+    // Nodes executed from Start: the exec chain, the pure nodes feeding it, and the blueprint's own functions it calls
+    static void CollectReachable(UBlueprint* Blueprint, UEdGraphNode* Start, TArray<UEdGraphNode*>& OutNodes);
+
+    // Edited since the last compile, so its generated class and defaults are stale
+    static bool IsOutOfDate(const UBlueprint* Blueprint);
+
+    static TSharedPtr<FJsonObject> MakeFinding(UBlueprint* Blueprint, const TCHAR* Rule, const TCHAR* Severity, const FString& Message, const FString& Suggestion);
+    static TSharedPtr<FJsonValue> MakeNodeRef(const UEdGraphNode* Node);
+    static int32 GetComponentDepth(const USCS_Node* Node, TArray<FString>& OutDeepestPath);
+};
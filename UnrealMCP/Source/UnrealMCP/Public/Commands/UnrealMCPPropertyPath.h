@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class UClass;
+class UStruct;
+class FProperty;
+
+/**
+ * A property path such as "StaticMeshComponent.RelativeLocation.X" or "Tags[2]"
+ * resolved against a class once and cached, so it can be applied to many objects.
+ *
+ * Path grammar: Segment ('.' Segment)*, where Segment is Name or Name[Index].
+ * On actor classes the first segment may also name a component instance or class.
+ * Paths that step through an object reference (a component pointer, for example)
+ * keep the remainder as a sub-path compiled against the referenced object's class.
+ */
+class UNREALMCP_API FUnrealMCPPropertyPath
+{
+public:
+    struct FSegment
+    {
+        FProperty* Property = nullptr;
+        // Element index into a static array (ArrayDim > 1) or a TArray, INDEX_NONE if unindexed
+        int32 ArrayIndex = INDEX_NONE;
+        bool bDynamicArray = false;
+    };
+
+    // Leaf of a resolved path: the property, the address of its value and the object that owns it.
+    // MemberProperty is the top level property of Owner that contains the leaf, for edit notifications.
+    struct FResolved
+    {
+        UObject* Owner = nullptr;
+        FProperty* MemberProperty = nullptr;
+        FProperty* Property = nullptr;
+        void* ValuePtr = nullptr;
+    };
+
+    // Compile Path against Class, returning a cached result when available
+    static TSharedPtr<const FUnrealMCPPropertyPath> Compile(UClass* Class, const FString& Path, FString& OutErrorMessage);
+
+    // Resolve this path on Object, which must be an instance of the class it was compiled for
+    bool Resolve(UObject* Object, FResolved& OutResolved, FString& OutErrorMessage) const;
+
+    // Compile and resolve in one step
+    static bool Resolve(UObject* Object, const FString& Path, FResolved& OutResolved, FString& OutErrorMessage);
+
+    // Drop all cached paths, e.g. after properties were regenerated by a blueprint compile
+    static void ClearCache();
+
+    const FString& GetPath() const { return Path; }
+    const TArray<FSegment>& GetSegments() const { return Segments; }
+
+private:
+    bool CompileSegments(UClass* Class, FString& OutErrorMessage);
+
+    FString Path;
+    TArray<FSegment> Segments;
+
+    // Component name when the first segment names a component rather than a property,
+    // and the component class it names, if any
+    FName ComponentName;
+    TWeakObjectPtr<UClass> ComponentClass;
+
+    // Remainder of the path past an object reference, compiled lazily against the runtime class
+    FString SubPath;
+
+    static TMap<FObjectKey, TMap<FString, TSharedPtr<const FUnrealMCPPropertyPath>>> Cache;
+};
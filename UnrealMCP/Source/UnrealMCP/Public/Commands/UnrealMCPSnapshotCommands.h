@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+class UWorld;
+class FUnrealMCPLevelSnapshot;
+class FUnrealMCPJsonWriter;
+
+/**
+ * Handler class for level snapshot MCP commands
+ * Captures the actors of the editor level into the compact binary snapshot format,
+ * and keeps named snapshots in memory so they can be diffed later.
+ */
+class UNREALMCP_API FUnrealMCPSnapshotCommands
+{
+public:
+    FUnrealMCPSnapshotCommands();
+
+    // Handle snapshot commands
+    TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
+    // Commands whose result can be written straight into the response buffer, so inline
+    // snapshot data reaches MessagePack connections as bin rather than base64
+    static bool IsStreamingCommand(const FString& CommandType);
+
+    // Write the result of a streaming command as one value.
+    // On failure nothing is written and OutErrorMessage is set.
+    bool StreamCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, FUnrealMCPJsonWriter& Writer, FString& OutErrorMessage);
+
+private:
+    // Specific snapshot command handlers
+    TSharedPtr<FJsonObject> HandleExportLevelSnapshot(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleCreateSnapshot(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleDiffSnapshots(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleDeleteSnapshot(const TSharedPtr<FJsonObject>& Params);
+    bool StreamExportLevelSnapshot(const TSharedPtr<FJsonObject>& Params, FUnrealMCPJsonWriter& Writer, FString& OutErrorMessage);
+
+    // A level snapshot written by export_level_snapshot, to FilePath or kept in Bytes when no path was given
+    struct FLevelSnapshotExport
+    {
+        FString LevelName;
+        int32 ActorCount = 0;
+        int32 StringCount = 0;
+        TArray<uint8> Bytes;
+        FString FilePath;
+    };
+    bool ExportLevelSnapshot(const TSharedPtr<FJsonObject>& Params, FLevelSnapshotExport& OutExport, FString& OutErrorMessage);
+
+    // Helper functions
+    void CaptureLevelSnapshot(UWorld* World, FUnrealMCPLevelSnapshot& OutSnapshot);
+    TSharedPtr<FJsonObject> SnapshotActorToJson(const FUnrealMCPLevelSnapshot& Snapshot, int32 ActorIndex);
+
+    // Snapshots held in memory, keyed by handle, oldest first in SnapshotOrder
+    TMap<FString, TSharedPtr<FUnrealMCPLevelSnapshot>> Snapshots;
+    TArray<FString> SnapshotOrder;
+    int32 NextSnapshotId;
+};
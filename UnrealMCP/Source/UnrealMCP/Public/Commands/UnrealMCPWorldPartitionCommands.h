@@ -0,0 +1,33 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+class UWorldPartition;
+class UWorldPartitionEditorLoaderAdapter;
+
+/**
+ * Handler class for World Partition MCP commands
+ * Queries actor descriptors without loading the actors, and loads regions on demand.
+ */
+class UNREALMCP_API FUnrealMCPWorldPartitionCommands
+{
+public:
+    FUnrealMCPWorldPartitionCommands();
+
+    // Handle world partition commands
+    TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
+private:
+    // Specific world partition command handlers
+    TSharedPtr<FJsonObject> HandleQueryActorDescs(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleLoadRegion(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleUnloadRegion(const TSharedPtr<FJsonObject>& Params);
+
+    // Helper functions
+    UWorldPartition* GetEditorWorldPartition(FString& OutErrorMessage);
+
+    // Regions loaded through load_world_partition_region, keyed by handle
+    TMap<FString, TWeakObjectPtr<UWorldPartitionEditorLoaderAdapter>> LoadedRegions;
+    int32 NextRegionId;
+};
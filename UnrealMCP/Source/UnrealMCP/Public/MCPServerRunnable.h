@@ -6,6 +6,7 @@
 #include "Interfaces/IPv4/IPv4Address.h"
 
 class UUnrealMCPBridge;
+class FUnrealMCPJsonView;
 
 /**
  * Runnable class for the MCP server thread
@@ -25,10 +26,16 @@ public:
 protected:
 	void HandleClientConnection(TSharedPtr<FSocket> ClientSocket);
 	void ProcessMessage(TSharedPtr<FSocket> Client, const FString& Message);
+	void ProcessRequest(const uint8* Data, int32 Length);
+	void HandleSetEncoding(const FUnrealMCPJsonView& Params);
+	void SendResponse(const TArray<uint8>& Response);
+	bool SendAll(const TArray<uint8>& Data);
 
 private:
 	UUnrealMCPBridge* Bridge;
 	TSharedPtr<FSocket> ListenerSocket;
 	TSharedPtr<FSocket> ClientSocket;
 	bool bRunning;
+	// Current connection negotiated MessagePack with length-prefixed framing
+	bool bMessagePack;
 }; 
\ No newline at end of file
@@ -13,9 +13,14 @@
 #include "Commands/UnrealMCPBlueprintNodeCommands.h"
 #include "Commands/UnrealMCPProjectCommands.h"
 #include "Commands/UnrealMCPUMGCommands.h"
+#include "Commands/UnrealMCPInstanceCommands.h"
+#include "Commands/UnrealMCPSnapshotCommands.h"
+#include "Commands/UnrealMCPWorldPartitionCommands.h"
 #include "UnrealMCPBridge.generated.h"
 
 class FMCPServerRunnable;
+class FUnrealMCPJsonDocument;
+class FUnrealMCPJsonView;
 
 UCLASS()
 class UNREALMCP_API UUnrealMCPBridge : public UObject
@@ -33,8 +38,21 @@ public:
 
 	// Command execution
 	FString ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+	void ExecuteCommandUtf8(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, TArray<uint8>& OutResponse);
+	// Execute a parsed request document; its "params" are read in place instead of being copied into a DOM.
+	// bMessagePack selects the response encoding, otherwise UTF-8 JSON.
+	void ExecuteRequestUtf8(const FString& CommandType, const TSharedRef<const FUnrealMCPJsonDocument>& Request, bool bMessagePack, TArray<uint8>& OutResponse);
 
 private:
+	void ExecuteOnGameThread(const FString& CommandType, const TSharedPtr<FJsonObject>& Params,
+		const TSharedPtr<const FUnrealMCPJsonDocument>& Request, bool bMessagePack, TArray<uint8>& OutResponse);
+	TSharedPtr<FJsonObject> DispatchRequest(const FString& CommandType, const FUnrealMCPJsonView& Params);
+	TSharedPtr<FJsonObject> DispatchCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleExecuteBatch(const FUnrealMCPJsonView& Params);
+
+	// Commands whose handlers read an FUnrealMCPJsonView instead of a DOM
+	static bool IsViewCommand(const FString& CommandType);
+
 	// Server state
 	bool bIsRunning;
 	TSharedPtr<FSocket> ListenerSocket;
@@ -51,4 +69,7 @@ private:
 	TSharedPtr<FUnrealMCPBlueprintNodeCommands> BlueprintNodeCommands;
 	TSharedPtr<FUnrealMCPProjectCommands> ProjectCommands;
 	TSharedPtr<FUnrealMCPUMGCommands> UMGCommands;
+	TSharedPtr<FUnrealMCPInstanceCommands> InstanceCommands;
+	TSharedPtr<FUnrealMCPSnapshotCommands> SnapshotCommands;
+	TSharedPtr<FUnrealMCPWorldPartitionCommands> WorldPartitionCommands;
 };
\ No newline at end of file
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+class FUnrealMCPJsonDocument;
+
+/**
+ * Read-only view of one value inside an FUnrealMCPJsonDocument.
+ * Views are small and cheap to copy; they are only valid while the document is alive.
+ * The accessors mirror FJsonObject so handler code reads the same either way.
+ */
+class UNREALMCP_API FUnrealMCPJsonView
+{
+public:
+	FUnrealMCPJsonView() : Document(nullptr), Index(INDEX_NONE), Element(INDEX_NONE) {}
+	FUnrealMCPJsonView(const FUnrealMCPJsonDocument* InDocument, int32 InIndex, int32 InElement = INDEX_NONE)
+		: Document(InDocument), Index(InIndex), Element(InElement) {}
+
+	bool IsValid() const { return Document != nullptr && Index != INDEX_NONE; }
+	EJson GetType() const;
+	bool IsObject() const { return GetType() == EJson::Object; }
+	bool IsArray() const { return GetType() == EJson::Array; }
+
+	// Element count of an array, field count of an object, 0 otherwise
+	int32 Num() const;
+
+	// Value accessors; mismatched types return a default value
+	double AsNumber() const;
+	bool AsBool() const;
+	FStringView AsStringView() const;
+	FString AsString() const { return FString(AsStringView()); }
+
+	// Object field lookup (case insensitive, like FJsonObject); returns an invalid view if missing
+	FUnrealMCPJsonView Find(const TCHAR* Key) const;
+	bool HasField(const TCHAR* Key) const { return Find(Key).IsValid(); }
+
+	bool TryGetStringField(const TCHAR* Key, FString& OutValue) const;
+	bool TryGetNumberField(const TCHAR* Key, double& OutValue) const;
+	bool TryGetNumberField(const TCHAR* Key, int32& OutValue) const;
+	bool TryGetBoolField(const TCHAR* Key, bool& OutValue) const;
+	bool TryGetArrayField(const TCHAR* Key, FUnrealMCPJsonView& OutValue) const;
+	bool TryGetObjectField(const TCHAR* Key, FUnrealMCPJsonView& OutValue) const;
+
+	// Visit array elements or object fields in order
+	void ForEachElement(TFunctionRef<void(const FUnrealMCPJsonView&)> Visitor) const;
+	void ForEachField(TFunctionRef<void(FStringView, const FUnrealMCPJsonView&)> Visitor) const;
+
+	/**
+	 * Zero-copy access to a packed float32 array (a MessagePack request's float array extension).
+	 * Returns false for ordinary arrays, which must be read element by element.
+	 */
+	bool TryGetFloatArray(TConstArrayView<float>& OutValues) const;
+
+	// Materialize as a regular DOM, for handlers that have not moved to views
+	TSharedPtr<FJsonValue> ToJsonValue() const;
+	TSharedPtr<FJsonObject> ToJsonObject() const;
+
+private:
+	const FUnrealMCPJsonDocument* Document;
+	int32 Index;
+	// Element of a packed float array, INDEX_NONE for values with their own tape node
+	int32 Element;
+};
+
+/**
+ * A parsed JSON or MessagePack document stored as a flat tape of nodes plus one
+ * string arena, instead of a tree of shared pointers. A request costs a handful of
+ * allocations that are released together when the document is destroyed.
+ *
+ * Containers are stored as a header node followed by their contents; each node
+ * records where its subtree ends, so skipping a value is O(1).
+ */
+class UNREALMCP_API FUnrealMCPJsonDocument
+{
+public:
+	// 24 bytes: a value is a number or a string, never both, so their payloads share storage
+	struct FNode
+	{
+		// Tape index just past this value's subtree
+		int32 Next = 0;
+		// Elements (arrays) or fields (objects)
+		int32 Count = 0;
+		union
+		{
+			// Numbers and booleans
+			double Number = 0.0;
+			// String payload in the arena, or the first float of a packed array
+			struct
+			{
+				int32 StringOffset;
+				int32 StringLength;
+			};
+		};
+		EJson Type = EJson::None;
+		// Array whose elements live in the float arena instead of on the tape
+		bool bPackedFloats = false;
+	};
+	static_assert(sizeof(FNode) == 24, "Keep tape nodes compact");
+
+	// MessagePack extension type carrying a little-endian float32 array
+	static constexpr int8 MessagePackFloatArrayType = 1;
+
+	// Parse UTF-8 JSON; returns false and sets OutErrorMessage on malformed input
+	bool Parse(const uint8* Data, int32 Length, FString& OutErrorMessage);
+
+	// Parse one MessagePack value into the same representation
+	bool ParseMessagePack(const uint8* Data, int32 Length, FString& OutErrorMessage);
+
+	FUnrealMCPJsonView GetRoot() const { return FUnrealMCPJsonView(this, Nodes.Num() > 0 ? 0 : INDEX_NONE); }
+
+	// Build a document from an existing DOM, for callers that only have an FJsonObject
+	static TSharedRef<FUnrealMCPJsonDocument> FromJsonObject(const TSharedPtr<FJsonObject>& Object);
+
+	// Scanner state carried between calls to FindDocumentEnd, so bytes are only looked at once
+	struct FScanState
+	{
+		int32 Offset = 0;
+		int32 Depth = 0;
+		bool bInString = false;
+		bool bEscape = false;
+	};
+
+	/**
+	 * Find where the first complete top-level object or array in Data ends.
+	 * Returns the byte count including the closing bracket, 0 if more data is needed,
+	 * or -1 if the data does not start with an object or array.
+	 * Reset State once a document has been consumed from the front of the buffer.
+	 */
+	static int32 FindDocumentEnd(const uint8* Data, int32 Length, FScanState& State);
+
+private:
+	friend class FUnrealMCPJsonView;
+	friend struct FUnrealMCPJsonParser;
+	friend struct FUnrealMCPMessagePackParser;
+
+	TArray<FNode> Nodes;
+	TArray<TCHAR> Strings;
+	TArray<float> Floats;
+};
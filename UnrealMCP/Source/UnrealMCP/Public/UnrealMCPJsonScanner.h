@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Byte scanners used by the request parser to skip over the parts of a UTF-8 JSON
+ * payload that need no per-byte work: plain string contents and everything between
+ * structural characters. Scans 32 bytes at a time with AVX2, 16 with SSE2 or NEON,
+ * and falls back to a scalar loop elsewhere or when UnrealMCP.Json.Vectorized is 0.
+ */
+class UNREALMCP_API FUnrealMCPJsonScanner
+{
+public:
+	/**
+	 * Index of the first byte at or after Start that ends a plain ASCII run in a string:
+	 * a quote, a backslash, a control character or a non-ASCII byte. Length if there is none.
+	 */
+	static int32 FindStringSpecial(const uint8* Data, int32 Start, int32 Length);
+
+	/**
+	 * Index of the first byte at or after Start that matters for document framing:
+	 * a quote or backslash inside a string, a quote or bracket outside one. Length if there is none.
+	 */
+	static int32 FindStructural(const uint8* Data, int32 Start, int32 Length, bool bInString);
+
+	// Whether the vectorized paths are compiled in and enabled
+	static bool IsVectorized();
+
+	// Name of the instruction set the vectorized paths use on this platform
+	static const TCHAR* GetInstructionSetName();
+
+private:
+	static int32 FindStringSpecialScalar(const uint8* Data, int32 Pos, int32 Length);
+	static int32 FindStructuralScalar(const uint8* Data, int32 Pos, int32 Length, bool bInString);
+};
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+/**
+ * Streaming JSON writer that appends UTF-8 straight into a byte buffer.
+ * Handlers that emit large results write through this instead of building an
+ * FJsonObject tree, so output costs a few buffer growths rather than one
+ * allocation per value. Commas and nesting are tracked by the writer.
+ *
+ * The write calls are virtual so FUnrealMCPMessagePackWriter can take its place on
+ * MessagePack connections without the handlers knowing which one they write to.
+ */
+class UNREALMCP_API FUnrealMCPJsonWriter
+{
+public:
+	explicit FUnrealMCPJsonWriter(TArray<uint8>& InBuffer);
+	virtual ~FUnrealMCPJsonWriter() = default;
+
+	virtual void BeginObject();
+	virtual void EndObject();
+	virtual void BeginArray();
+	virtual void EndArray();
+
+	// Write an object key; the next write is its value
+	virtual void WriteKey(const TCHAR* Key);
+	virtual void WriteKey(const FString& Key);
+
+	virtual void WriteString(const TCHAR* Value);
+	virtual void WriteString(const FString& Value);
+	virtual void WriteNumber(double Value);
+	virtual void WriteInt(int64 Value);
+	virtual void WriteBool(bool Value);
+	virtual void WriteNull();
+
+	// A number array, or with bBase64 the raw little-endian floats as a base64 string.
+	// MessagePack always packs it as the float array extension.
+	virtual void WriteFloatArray(TConstArrayView<float> Values, bool bBase64);
+
+	// Raw bytes as a base64 string; MessagePack writes them as bin instead.
+	// WritesRawBinary tells handlers which of the two a client will receive.
+	virtual void WriteBinary(TConstArrayView<uint8> Bytes);
+	virtual bool WritesRawBinary() const { return false; }
+
+	// [X, Y, Z] and [Pitch, Yaw, Roll], matching the array layout used by the command API
+	void WriteVector(const FVector& Value);
+	void WriteRotator(const FRotator& Value);
+
+	// Write an existing DOM value, for results that were built as FJsonObject trees
+	void WriteJsonValue(const TSharedPtr<FJsonValue>& Value);
+	void WriteJsonObject(const TSharedPtr<FJsonObject>& Object);
+
+	// Convenience for key/value pairs
+	void WriteStringField(const TCHAR* Key, const FString& Value) { WriteKey(Key); WriteString(Value); }
+	void WriteNumberField(const TCHAR* Key, double Value) { WriteKey(Key); WriteNumber(Value); }
+	void WriteBoolField(const TCHAR* Key, bool Value) { WriteKey(Key); WriteBool(Value); }
+
+	TArray<uint8>& GetBuffer() { return Buffer; }
+
+protected:
+	TArray<uint8>& Buffer;
+
+private:
+	void WriteSeparator();
+	void WriteEscaped(const TCHAR* Value, int32 Length);
+	void Append(const ANSICHAR* Data, int32 Length);
+	void Append(ANSICHAR Character) { Buffer.Add(static_cast<uint8>(Character)); }
+
+	// One entry per open object or array: whether a value has been written at that level
+	TArray<bool, TInlineAllocator<32>> HasValue;
+	bool bAfterKey;
+};
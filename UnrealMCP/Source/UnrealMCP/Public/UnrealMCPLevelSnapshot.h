@@ -0,0 +1,69 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * One actor record in a level snapshot.
+ * String fields are indices into FUnrealMCPLevelSnapshot::Strings; INDEX_NONE means unset.
+ */
+struct FUnrealMCPSnapshotActor
+{
+	int32 NameIndex = INDEX_NONE;
+	int32 LabelIndex = INDEX_NONE;
+	int32 ClassIndex = INDEX_NONE;
+	int32 FolderIndex = INDEX_NONE;
+	int32 ParentIndex = INDEX_NONE;
+	FVector3f Location = FVector3f::ZeroVector;
+	FRotator3f Rotation = FRotator3f::ZeroRotator;
+	FVector3f Scale = FVector3f::OneVector;
+};
+
+/**
+ * Compact binary snapshot of the actors in a level, with its reader and writer.
+ *
+ * Layout (little endian):
+ *   uint32 Magic ('UMCS'), uint16 Version, uint16 Flags
+ *   uint32 StringCount, then per string: uint32 ByteLength + UTF-8 bytes
+ *   uint32 LevelNameIndex
+ *   uint32 ActorCount, then per actor a fixed 56 byte record:
+ *     uint32 Name, Label, Class, Folder, Parent (string indices, 0xFFFFFFFF = none)
+ *     float32 Location XYZ, Rotation Pitch/Yaw/Roll, Scale XYZ
+ *
+ * Class names are stored once in the string table, so a record costs the same
+ * no matter how long its strings are.
+ */
+class UNREALMCP_API FUnrealMCPLevelSnapshot
+{
+public:
+	static constexpr uint32 Magic = 0x53434D55;
+	static constexpr uint16 Version = 1;
+
+	FString LevelName;
+	TArray<FString> Strings;
+	TArray<FUnrealMCPSnapshotActor> Actors;
+
+	// Returns the index of String in the string table, adding it if needed
+	int32 AddString(const FString& String);
+
+	// Returns the string at Index, or an empty string for INDEX_NONE
+	const FString& GetString(int32 Index) const;
+
+	// Serialize to the binary format
+	void Write(TArray<uint8>& OutBytes) const;
+
+	// Load from the binary format, replacing the current contents
+	bool Read(const TArray<uint8>& Bytes, FString& OutErrorMessage);
+
+	bool SaveToFile(const FString& FilePath) const;
+	bool LoadFromFile(const FString& FilePath, FString& OutErrorMessage);
+
+private:
+	// Actor labels are case sensitive, unlike the default FString key comparison
+	struct FStringKeyFuncs : TDefaultMapKeyFuncs<FString, int32, false>
+	{
+		static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+		static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+	};
+
+	TMap<FString, int32, FDefaultSetAllocator, FStringKeyFuncs> StringIndices;
+};
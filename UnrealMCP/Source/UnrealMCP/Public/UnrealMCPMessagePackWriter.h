@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UnrealMCPJsonWriter.h"
+
+/**
+ * FUnrealMCPJsonWriter counterpart that appends MessagePack, for connections that negotiated
+ * it with set_encoding. Handlers and the bridge write responses through the same calls, so a
+ * response is encoded once instead of being written as JSON and converted.
+ *
+ * Streamed results do not know their size up front, so maps and arrays get 32-bit headers
+ * whose counts are filled in when they close. WriteFloatArray emits the float array
+ * extension, the same encoding MessagePack requests use for packed arrays; get_mesh_instances
+ * sends its locations, rotations and scales that way. WriteBinary emits bin, which
+ * export_level_snapshot uses for inline snapshot data.
+ */
+class UNREALMCP_API FUnrealMCPMessagePackWriter : public FUnrealMCPJsonWriter
+{
+public:
+	explicit FUnrealMCPMessagePackWriter(TArray<uint8>& InBuffer);
+
+	virtual void BeginObject() override;
+	virtual void EndObject() override;
+	virtual void BeginArray() override;
+	virtual void EndArray() override;
+
+	virtual void WriteKey(const TCHAR* Key) override;
+	virtual void WriteKey(const FString& Key) override;
+
+	virtual void WriteString(const TCHAR* Value) override;
+	virtual void WriteString(const FString& Value) override;
+	virtual void WriteNumber(double Value) override;
+	virtual void WriteInt(int64 Value) override;
+	virtual void WriteBool(bool Value) override;
+	virtual void WriteNull() override;
+
+	virtual void WriteFloatArray(TConstArrayView<float> Values, bool bBase64) override;
+	virtual void WriteBinary(TConstArrayView<uint8> Bytes) override;
+	virtual bool WritesRawBinary() const override { return true; }
+
+private:
+	struct FOpenContainer
+	{
+		// Offset of the 0xDF/0xDD tag whose 32-bit count is patched on close
+		int32 HeaderOffset = 0;
+		// Fields of a map or elements of an array written so far
+		uint32 Count = 0;
+		bool bMap = false;
+	};
+
+	// Count a value in the enclosing array; map fields are counted by their key
+	void BeginValue();
+	void BeginContainer(uint8 Tag, bool bMap);
+	void EndContainer();
+
+	TArray<FOpenContainer, TInlineAllocator<32>> Open;
+};
@@ -27,9 +27,11 @@ public class UnrealMCP : ModuleRules
                 "Sockets",
                 "Networking",
                 "BlueprintGraph",
+                "Kismet",
                 "KismetCompiler",
                 "GraphEditor",
-                "PropertyEditor"
+                "PropertyEditor",
+                "Landscape"
             }
         );
     }